@@ -0,0 +1,280 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_scan_kernels.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/fixed_size_attribute_vector.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+// Micro benchmarks for storage and operator code paths. Usage: hyriseBenchmark [row_count]
+//
+// Each benchmark reports the best of REPETITIONS runs, which hides most of the noise from page faults and the
+// allocator on the first run.
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto REPETITIONS = 3;
+
+template <typename Functor>
+double measure_milliseconds(const Functor& functor) {
+  auto best = std::numeric_limits<double>::max();
+  for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+    const auto begin = std::chrono::steady_clock::now();
+    functor();
+    const auto end = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double, std::milli>(end - begin).count());
+  }
+  return best;
+}
+
+void print_result(const std::string& name, const double baseline_milliseconds, const double milliseconds) {
+  std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(1) << std::setw(10)
+            << baseline_milliseconds << " ms" << std::setw(10) << milliseconds << " ms" << std::setw(8)
+            << baseline_milliseconds / milliseconds << "x" << std::endl;
+}
+
+// The construction DictionarySegment used before: sort all rows, then binary search the value id of every row and
+// write it through the virtual set().
+template <typename T>
+size_t naive_dictionary_encode(const ValueSegment<T>& segment) {
+  const auto& values = segment.values();
+  auto dictionary = std::vector<T>(values.cbegin(), values.cend());
+  std::sort(dictionary.begin(), dictionary.end());
+  dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+
+  auto attribute_vector = std::shared_ptr<BaseAttributeVector>{
+      std::make_shared<FixedSizeAttributeVector<uint32_t>>(values.size())};
+  for (auto row = size_t{0}; row < values.size(); ++row) {
+    const auto value_id = std::lower_bound(dictionary.begin(), dictionary.end(), values[row]) - dictionary.begin();
+    attribute_vector->set(row, ValueID(static_cast<ValueID::base_type>(value_id)));
+  }
+  return dictionary.size() + attribute_vector->size();
+}
+
+template <typename T>
+void benchmark_dictionary_construction(const std::string& name, const std::shared_ptr<ValueSegment<T>>& segment) {
+  auto checksum = size_t{0};
+  const auto baseline = measure_milliseconds([&]() { checksum += naive_dictionary_encode(*segment); });
+  const auto optimized = measure_milliseconds([&]() { checksum += DictionarySegment<T>{segment}.size(); });
+  print_result(name, baseline, optimized);
+  if (checksum == 0) std::cout << "unexpected checksum" << std::endl;
+}
+
+void benchmark_dictionary_segments(const size_t row_count) {
+  auto generator = std::mt19937{42};
+
+  for (const auto distinct_count : {size_t{100}, size_t{100'000}, row_count}) {
+    auto distribution = std::uniform_int_distribution<size_t>{0, distinct_count - 1};
+
+    auto int_segment = std::make_shared<ValueSegment<int>>();
+    auto string_segment = std::make_shared<ValueSegment<std::string>>();
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      const auto value = distribution(generator);
+      int_segment->append(static_cast<int>(value));
+      string_segment->append("Customer#" + std::to_string(value * 7919));
+    }
+
+    const auto suffix = " (" + std::to_string(distinct_count) + " distinct)";
+    benchmark_dictionary_construction("DictionarySegment<int>" + suffix, int_segment);
+    benchmark_dictionary_construction("DictionarySegment<string>" + suffix, string_segment);
+  }
+}
+
+// appends row_count rows to a fresh table from thread_count threads
+void append_rows(const size_t row_count, const size_t thread_count) {
+  auto table = Table{100'000};
+  table.add_column("id", "int");
+  table.add_column("name", "string");
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = size_t{0}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto row = thread_id; row < row_count; row += thread_count) {
+        table.append({static_cast<int>(row), "Customer#" + std::to_string(row)});
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+// the baseline is a single writer, so the speedup shows how appends scale with the number of writers
+void benchmark_concurrent_appends(const size_t row_count) {
+  const auto baseline = measure_milliseconds([&]() { append_rows(row_count, 1); });
+  for (const auto thread_count : {size_t{2}, size_t{4}, size_t{8}, size_t{16}}) {
+    const auto concurrent = measure_milliseconds([&]() { append_rows(row_count, thread_count); });
+    print_result("Table::append (" + std::to_string(thread_count) + " writers)", baseline, concurrent);
+  }
+}
+
+// compares loading whole columns with append_segments() to appending the same rows one by one
+void benchmark_bulk_append(const size_t row_count) {
+  auto ids = std::vector<int>(row_count);
+  auto names = std::vector<std::string>(row_count);
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    ids[row] = static_cast<int>(row);
+    names[row] = "Customer#" + std::to_string(row);
+  }
+
+  const auto create_table = []() {
+    auto table = std::make_shared<Table>(100'000);
+    table->add_column("id", "int");
+    table->add_column("name", "string");
+    return table;
+  };
+
+  const auto row_by_row = measure_milliseconds([&]() {
+    const auto table = create_table();
+    for (auto row = size_t{0}; row < row_count; ++row) table->append({ids[row], names[row]});
+  });
+  const auto bulk = measure_milliseconds([&]() {
+    const auto table = create_table();
+    auto id_values = ids;
+    auto name_values = names;
+    table->append_segments({std::make_shared<ValueSegment<int>>(std::move(id_values)),
+                            std::make_shared<ValueSegment<std::string>>(std::move(name_values))});
+  });
+  print_result("Table::append_segments", row_by_row, bulk);
+}
+
+// sums up a segment once through the virtual operator[] and once through segment_iterate
+void benchmark_segment_access(const std::string& name, const BaseSegment& segment) {
+  auto checksum = int64_t{0};
+  const auto size = static_cast<ChunkOffset>(segment.size());
+  const auto baseline = measure_milliseconds([&]() {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      checksum += type_cast<int>(segment[chunk_offset]);
+    }
+  });
+  const auto iterated = measure_milliseconds([&]() {
+    segment_iterate<int>(segment, [&](const int value, const ChunkOffset) { checksum += value; });
+  });
+  print_result(name, baseline, iterated);
+  if (checksum == 0) std::cout << "unexpected checksum" << std::endl;
+}
+
+void benchmark_segment_iteration(const size_t row_count) {
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int>{1, 1000};
+
+  auto table = std::make_shared<Table>(static_cast<uint32_t>(row_count));
+  table->add_column("a", "int");
+  auto values = std::vector<int>(row_count);
+  for (auto& value : values) value = distribution(generator);
+  table->append_segments({std::make_shared<ValueSegment<int>>(std::move(values))});
+  const auto value_segment = table->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+
+  benchmark_segment_access("segment_iterate ValueSegment<int>", *value_segment);
+  benchmark_segment_access("segment_iterate DictionarySegment<int>",
+                           *encode_segment(EncodingType::Dictionary, "int", value_segment));
+  benchmark_segment_access("segment_iterate FrameOfReferenceSegment<int>",
+                           *encode_segment(EncodingType::FrameOfReference, "int", value_segment));
+
+  // every other row in random order
+  auto row_ids = std::vector<RowID>{};
+  for (auto row = size_t{0}; row < row_count; row += 2) {
+    row_ids.push_back(RowID{ChunkID{0}, static_cast<ChunkOffset>(row)});
+  }
+  std::shuffle(row_ids.begin(), row_ids.end(), generator);
+  const auto pos_list = std::make_shared<PosList>(std::move(row_ids));
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  benchmark_segment_access("segment_iterate ReferenceSegment", reference_segment);
+
+  // positions spread over many chunks in random order, which segment_iterate resolves one position at a time
+  auto chunked_table = std::make_shared<Table>(10'000);
+  chunked_table->add_column("a", "int");
+  chunked_table->append_segments({std::dynamic_pointer_cast<const BaseValueSegment>(value_segment)});
+  auto chunked_row_ids = std::vector<RowID>{};
+  for (auto row = size_t{0}; row < row_count; row += 2) {
+    const auto chunk_id = ChunkID{static_cast<uint32_t>(row / 10'000)};
+    chunked_row_ids.push_back(RowID{chunk_id, static_cast<ChunkOffset>(row % 10'000)});
+  }
+  std::shuffle(chunked_row_ids.begin(), chunked_row_ids.end(), generator);
+  const auto chunked_pos_list = std::make_shared<PosList>(std::move(chunked_row_ids));
+  const auto chunked_reference_segment = ReferenceSegment{chunked_table, ColumnID{0}, chunked_pos_list};
+
+  auto checksum = int64_t{0};
+  const auto iterated = measure_milliseconds([&]() {
+    segment_iterate<int>(chunked_reference_segment, [&](const int value, const ChunkOffset) { checksum += value; });
+  });
+  const auto materialized = measure_milliseconds([&]() {
+    for (const auto value : chunked_reference_segment.materialize<int>()) checksum += value;
+  });
+  print_result("ReferenceSegment::materialize (random chunks)", iterated, materialized);
+  if (checksum == 0) std::cout << "unexpected checksum" << std::endl;
+}
+
+void benchmark_value_scan(const size_t row_count) {
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int>{1, 1000};
+  auto values = std::vector<int>(row_count);
+  for (auto& value : values) value = distribution(generator);
+
+  auto matches = std::vector<ChunkOffset>{};
+  for (const auto search_value : {10, 500}) {
+    const auto scan = [&](const ScanKernelType kernel_type) {
+      return measure_milliseconds([&]() {
+        matches.clear();
+        scan_values(values.data(), values.size(), ScanType::OpLessThan, search_value, matches, kernel_type);
+      });
+    };
+    const auto kernel_names = std::vector<std::string>{"scalar", "AVX2", "AVX-512"};
+    const auto name = "scan_values < " + std::to_string(search_value) + " (" +
+                      kernel_names[static_cast<size_t>(fastest_scan_kernel_type())] + ")";
+    print_result(name, scan(ScanKernelType::Scalar), scan(fastest_scan_kernel_type()));
+  }
+}
+
+void benchmark_parallel_scan(const size_t row_count) {
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int>{1, 1000};
+  auto table = std::make_shared<Table>(65'536);
+  table->add_column("a", "int");
+  for (auto row = size_t{0}; row < row_count; ++row) table->append({distribution(generator)});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto scan = [&](const size_t max_degree) {
+    return measure_milliseconds([&]() {
+      auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 500);
+      table_scan->set_parallelism({0, max_degree});
+      table_scan->execute();
+    });
+  };
+  const auto thread_count = std::max(1u, std::thread::hardware_concurrency());
+  print_result("TableScan < 500 (" + std::to_string(thread_count) + " threads)", scan(1),
+               scan(std::numeric_limits<size_t>::max()));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto row_count = argc > 1 ? std::stoul(argv[1]) : size_t{4'000'000};
+
+  std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(13) << "Baseline" << std::setw(13)
+            << "Optimized" << std::setw(9) << "Speedup" << std::endl;
+  benchmark_dictionary_segments(row_count);
+  benchmark_segment_iteration(row_count);
+  benchmark_value_scan(row_count);
+  benchmark_parallel_scan(row_count);
+  benchmark_bulk_append(row_count);
+  benchmark_concurrent_appends(row_count);
+  return 0;
+}
@@ -0,0 +1,208 @@
+#include "column_comparison_table_scan.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "table_scan_impl.hpp"
+
+namespace opossum {
+
+namespace {
+
+class BaseColumnComparisonScanImpl {
+ public:
+  virtual ~BaseColumnComparisonScanImpl() = default;
+
+  // appends the offsets of all rows for which `left_segment <scan_type> right_segment` holds to matches
+  virtual void scan_segments(const BaseSegment& left_segment, const BaseSegment& right_segment,
+                             std::vector<ChunkOffset>& matches) const = 0;
+};
+
+template <typename T>
+class ColumnComparisonScanImpl : public BaseColumnComparisonScanImpl {
+ public:
+  explicit ColumnComparisonScanImpl(const ScanType scan_type) : _scan_type(scan_type) {}
+
+  void scan_segments(const BaseSegment& left_segment, const BaseSegment& right_segment,
+                     std::vector<ChunkOffset>& matches) const final {
+    const auto left_dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&left_segment);
+    const auto right_dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&right_segment);
+    if (left_dictionary_segment && right_dictionary_segment) {
+      _scan_dictionary_segments(*left_dictionary_segment, *right_dictionary_segment, matches);
+      return;
+    }
+
+    // Other encodings are compared row by row. Segments that do not store their values contiguously, i.e., all but
+    // ValueSegments, are decoded into a buffer first. The spans keep the values alive while appends grow the segments,
+    // and only rows that are visible in both snapshots are compared.
+    auto left_buffer = std::vector<T>{};
+    auto right_buffer = std::vector<T>{};
+    const auto left_values = _contiguous_values(left_segment, left_buffer);
+    const auto right_values = _contiguous_values(right_segment, right_buffer);
+    const auto size = std::min(left_values.size(), right_values.size());
+    if constexpr (std::is_arithmetic_v<T>) {
+      scan_value_pairs(left_values.data(), right_values.data(), size, _scan_type, matches);
+    } else {
+      _resolve_comparator([&](const auto& comparator) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+          if (comparator(left_values[chunk_offset], right_values[chunk_offset])) matches.push_back(chunk_offset);
+        }
+      });
+    }
+  }
+
+ protected:
+  static ValueSpan<T> _contiguous_values(const BaseSegment& segment, std::vector<T>& buffer) {
+    if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+      return value_segment->values();
+    }
+
+    buffer.resize(segment.size());
+    segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) { buffer[chunk_offset] = value; });
+    return ValueSpan<T>{buffer.data(), buffer.size()};
+  }
+
+  // Every left value id is translated into the range [lower_bound, upper_bound) of right value ids that refer to the
+  // same value, which is empty if the right dictionary does not contain it. Then, e.g., `left < right` holds iff
+  // `right_value_id >= upper_bound`. The ranges are found by merging the two sorted dictionaries.
+  void _scan_dictionary_segments(const DictionarySegment<T>& left_segment, const DictionarySegment<T>& right_segment,
+                                 std::vector<ChunkOffset>& matches) const {
+    const auto left_dictionary_size = left_segment.unique_values_count();
+    auto lower_bounds = std::vector<uint32_t>(left_dictionary_size);
+    auto upper_bounds = std::vector<uint32_t>(left_dictionary_size);
+    if (left_segment.dictionary() == right_segment.dictionary()) {
+      // a shared dictionary maps each value id to itself
+      std::iota(lower_bounds.begin(), lower_bounds.end(), uint32_t{0});
+      std::iota(upper_bounds.begin(), upper_bounds.end(), uint32_t{1});
+    } else {
+      _resolve_dictionary(left_segment, [&](const std::vector<T>& left_dictionary) {
+        _resolve_dictionary(right_segment, [&](const std::vector<T>& right_dictionary) {
+          auto right_value_id = uint32_t{0};
+          for (auto left_value_id = size_t{0}; left_value_id < left_dictionary_size; ++left_value_id) {
+            const auto& value = left_dictionary[left_value_id];
+            while (right_value_id < right_dictionary.size() && right_dictionary[right_value_id] < value) {
+              ++right_value_id;
+            }
+            lower_bounds[left_value_id] = right_value_id;
+            const auto contains_value =
+                right_value_id < right_dictionary.size() && !(value < right_dictionary[right_value_id]);
+            upper_bounds[left_value_id] = right_value_id + (contains_value ? 1 : 0);
+          }
+        });
+      });
+    }
+
+    _resolve_value_id_predicate(lower_bounds, upper_bounds, [&](const auto& matches_value_ids) {
+      const auto size = static_cast<ChunkOffset>(left_segment.size());
+      auto left_value_ids = std::vector<ValueID>{};
+      auto right_value_ids = std::vector<ValueID>{};
+      for (auto begin = ChunkOffset{0}; begin < size; begin += DECODE_BLOCK_SIZE) {
+        const auto end = std::min(size, begin + DECODE_BLOCK_SIZE);
+        left_segment.attribute_vector()->decode(begin, end, left_value_ids);
+        right_segment.attribute_vector()->decode(begin, end, right_value_ids);
+        for (auto index = ChunkOffset{0}; index < end - begin; ++index) {
+          if (matches_value_ids(left_value_ids[index], right_value_ids[index])) matches.push_back(begin + index);
+        }
+      }
+    });
+  }
+
+  // calls functor with the dictionary of the segment as a vector, front-coded string dictionaries are decoded first
+  template <typename Functor>
+  static void _resolve_dictionary(const DictionarySegment<T>& segment, const Functor& functor) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      auto dictionary = std::vector<std::string>(segment.unique_values_count());
+      segment.dictionary()->for_each([&](const size_t index, const std::string& value) { dictionary[index] = value; });
+      functor(dictionary);
+    } else {
+      functor(*segment.dictionary());
+    }
+  }
+
+  // calls functor with a function that returns whether a pair of left and right value ids satisfies the predicate
+  template <typename Functor>
+  void _resolve_value_id_predicate(const std::vector<uint32_t>& lower_bounds, const std::vector<uint32_t>& upper_bounds,
+                                   const Functor& functor) const {
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return functor([&](const ValueID left, const ValueID right) {
+          return right >= lower_bounds[left] && right < upper_bounds[left];
+        });
+      case ScanType::OpNotEquals:
+        return functor([&](const ValueID left, const ValueID right) {
+          return right < lower_bounds[left] || right >= upper_bounds[left];
+        });
+      case ScanType::OpLessThan:
+        return functor([&](const ValueID left, const ValueID right) { return right >= upper_bounds[left]; });
+      case ScanType::OpLessThanEquals:
+        return functor([&](const ValueID left, const ValueID right) { return right >= lower_bounds[left]; });
+      case ScanType::OpGreaterThan:
+        return functor([&](const ValueID left, const ValueID right) { return right < lower_bounds[left]; });
+      case ScanType::OpGreaterThanEquals:
+        return functor([&](const ValueID left, const ValueID right) { return right < upper_bounds[left]; });
+    }
+    Fail("Unknown scan type");
+  }
+
+  // calls functor with the std:: comparator of the scan type
+  template <typename Functor>
+  void _resolve_comparator(const Functor& functor) const {
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return functor(std::equal_to<T>{});
+      case ScanType::OpNotEquals:
+        return functor(std::not_equal_to<T>{});
+      case ScanType::OpLessThan:
+        return functor(std::less<T>{});
+      case ScanType::OpLessThanEquals:
+        return functor(std::less_equal<T>{});
+      case ScanType::OpGreaterThan:
+        return functor(std::greater<T>{});
+      case ScanType::OpGreaterThanEquals:
+        return functor(std::greater_equal<T>{});
+    }
+    Fail("Unknown scan type");
+  }
+
+  const ScanType _scan_type;
+};
+
+}  // namespace
+
+ColumnComparisonTableScan::ColumnComparisonTableScan(const std::shared_ptr<const AbstractOperator> in,
+                                                     const ColumnID left_column_id, const ScanType scan_type,
+                                                     const ColumnID right_column_id)
+    : AbstractOperator(in),
+      _left_column_id(left_column_id),
+      _scan_type(scan_type),
+      _right_column_id(right_column_id) {}
+
+ColumnComparisonTableScan::~ColumnComparisonTableScan() = default;
+
+ColumnID ColumnComparisonTableScan::left_column_id() const { return _left_column_id; }
+
+ScanType ColumnComparisonTableScan::scan_type() const { return _scan_type; }
+
+ColumnID ColumnComparisonTableScan::right_column_id() const { return _right_column_id; }
+
+std::shared_ptr<const Table> ColumnComparisonTableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto& column_type = input_table->column_type(_left_column_id);
+  Assert(column_type == input_table->column_type(_right_column_id), "Only columns of the same type can be compared");
+  const auto impl =
+      make_unique_by_data_type<BaseColumnComparisonScanImpl, ColumnComparisonScanImpl>(column_type, _scan_type);
+
+  return scan_table(input_table, [&](const Chunk& chunk, std::vector<ChunkOffset>& matches) {
+    impl->scan_segments(*chunk.get_segment(_left_column_id), *chunk.get_segment(_right_column_id), matches);
+  });
+}
+
+}  // namespace opossum
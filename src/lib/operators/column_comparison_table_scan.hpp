@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Selects the rows for which `left_column <scan_type> right_column` holds, e.g., `shipped_at > ordered_at`. Both
+// columns have to be of the same table and the same data type.
+class ColumnComparisonTableScan : public AbstractOperator {
+ public:
+  ColumnComparisonTableScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID left_column_id,
+                            const ScanType scan_type, const ColumnID right_column_id);
+
+  ~ColumnComparisonTableScan();
+
+  ColumnID left_column_id() const;
+  ScanType scan_type() const;
+  ColumnID right_column_id() const;
+
+ protected:
+  // Compares the two segments of each chunk with a routine for their pair of encodings. Two DictionarySegments are
+  // compared in value id space, two ValueSegments of numbers with the scan kernels.
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _left_column_id;
+  const ScanType _scan_type;
+  const ColumnID _right_column_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,490 @@
+#include "conjunctive_table_scan.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "table_scan_impl.hpp"
+
+namespace opossum {
+
+namespace {
+
+// estimated selectivities of predicates on segments without a dictionary
+constexpr auto EQUALS_SELECTIVITY = 0.1f;
+constexpr auto NOT_EQUALS_SELECTIVITY = 0.9f;
+constexpr auto BETWEEN_SELECTIVITY = 0.25f;
+constexpr auto RANGE_SELECTIVITY = 0.33f;
+
+// IN lists with at most this many values are compared with the scan kernels, longer ones are probed in a hash set
+constexpr auto KERNEL_IN_LIST_MAX_SIZE = size_t{16};
+
+// removes the positions for which predicate(position) does not hold
+template <typename Predicate>
+void retain_positions(std::vector<ChunkOffset>& positions, const Predicate& predicate) {
+  positions.erase(std::remove_if(positions.begin(), positions.end(),
+                                 [&](const ChunkOffset position) { return !predicate(position); }),
+                  positions.end());
+}
+
+// removes the positions whose value does not satisfy matches_value(value) from the sorted positions
+template <typename T, typename Predicate>
+void filter_values(const BaseSegment& segment, std::vector<ChunkOffset>& positions, const Predicate& matches_value) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto values = value_segment->values();
+    retain_positions(positions, [&](const ChunkOffset position) { return matches_value(values[position]); });
+    return;
+  }
+
+  // other segments are iterated, the selected positions are checked when they pass by
+  auto position = positions.cbegin();
+  auto retained_position = positions.begin();
+  segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+    if (position == positions.cend() || *position != chunk_offset) return;
+    if (matches_value(value)) *retained_position++ = chunk_offset;
+    ++position;
+  });
+  positions.erase(retained_position, positions.end());
+}
+
+// removes the positions whose value id does not satisfy matches_value_id(value_id)
+template <typename Predicate>
+void filter_value_ids(const BaseAttributeVector& attribute_vector, std::vector<ChunkOffset>& positions,
+                      const Predicate& matches_value_id) {
+  auto filtered = false;
+  const auto filter_fixed_size_value_ids = [&](const auto* fixed_size_attribute_vector) {
+    if (!fixed_size_attribute_vector) return;
+    const auto& value_ids = fixed_size_attribute_vector->values();
+    retain_positions(positions, [&](const ChunkOffset position) { return matches_value_id(value_ids[position]); });
+    filtered = true;
+  };
+  filter_fixed_size_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(&attribute_vector));
+  filter_fixed_size_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(&attribute_vector));
+  filter_fixed_size_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(&attribute_vector));
+  if (filtered) return;
+
+  retain_positions(positions,
+                   [&](const ChunkOffset position) { return matches_value_id(attribute_vector.get(position)); });
+}
+
+// Open addressing hash set with linear probing for the values of an IN list. The values are stored in a single array
+// that is at most half full, so that most lookups only touch one slot.
+template <typename T>
+class InListHashSet {
+ public:
+  explicit InListHashSet(const std::vector<T>& values) {
+    auto bit_count = 1;
+    while ((size_t{1} << bit_count) < values.size() * 2) ++bit_count;
+    _shift = 64 - bit_count;
+    _mask = (size_t{1} << bit_count) - 1;
+    _slots.resize(_mask + 1);
+    _occupied.resize(_mask + 1);
+
+    for (const auto& value : values) {
+      auto slot = _slot(value);
+      while (_occupied[slot] && !(_slots[slot] == value)) slot = (slot + 1) & _mask;
+      _slots[slot] = value;
+      _occupied[slot] = true;
+    }
+  }
+
+  bool contains(const T& value) const {
+    for (auto slot = _slot(value); _occupied[slot]; slot = (slot + 1) & _mask) {
+      if (_slots[slot] == value) return true;
+    }
+    return false;
+  }
+
+ protected:
+  // multiplicative hashing spreads the hashes of integers, which std::hash returns unchanged
+  size_t _slot(const T& value) const { return (std::hash<T>{}(value) * 0x9E3779B97F4A7C15ull) >> _shift; }
+
+  int _shift;
+  size_t _mask;
+  std::vector<T> _slots;
+  std::vector<bool> _occupied;
+};
+
+// What a scanner has derived from one segment, kept per chunk so that estimating, scanning and filtering the segment
+// derive it only once
+struct SegmentScanState {
+  // the value ids of an IN list in a dictionary segment
+  std::optional<std::vector<bool>> value_id_bitmap;
+};
+
+// Evaluates a single predicate on segments. It is implemented per data type, like BaseTableScanImpl. All calls for the
+// same segment get the same state.
+class BasePredicateScanner {
+ public:
+  virtual ~BasePredicateScanner() = default;
+
+  // returns whether the segment filters (e.g., zone maps) of the chunk rule out any match
+  virtual bool can_prune(const Chunk& chunk) const = 0;
+
+  // returns the estimated share of the rows of the segment that satisfy the predicate
+  virtual float estimate_selectivity(const BaseSegment& segment, SegmentScanState& state) const = 0;
+
+  // appends the offsets of all rows of the segment that satisfy the predicate to the empty matches
+  virtual void scan_segment(const BaseSegment& segment, SegmentScanState& state,
+                            std::vector<ChunkOffset>& matches) const = 0;
+
+  // removes the offsets of rows that do not satisfy the predicate from the sorted positions
+  virtual void filter_segment(const BaseSegment& segment, SegmentScanState& state,
+                              std::vector<ChunkOffset>& positions) const = 0;
+};
+
+template <typename T>
+class PredicateScanner : public BasePredicateScanner {
+ public:
+  explicit PredicateScanner(const ScanPredicate& predicate)
+      : _predicate(predicate),
+        _value(type_cast<T>(predicate.value())),
+        _upper_value(predicate.is_between() ? type_cast<T>(predicate.upper_value()) : _value),
+        _table_scan_impl(predicate.scan_type(), predicate.value()) {}
+
+  bool can_prune(const Chunk& chunk) const final {
+    const auto column_id = _predicate.column_id();
+    if (chunk.can_prune(column_id, _predicate.scan_type(), _predicate.value())) return true;
+    return _predicate.is_between() &&
+           chunk.can_prune(column_id, ScanType::OpLessThanEquals, _predicate.upper_value());
+  }
+
+  float estimate_selectivity(const BaseSegment& segment, SegmentScanState&) const final {
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      // assumes that all values of the dictionary are equally frequent
+      const auto range = _value_id_range(*dictionary_segment);
+      const auto share =
+          static_cast<float>(range.end - range.begin) / static_cast<float>(dictionary_segment->unique_values_count());
+      return range.negated ? 1.0f - share : share;
+    }
+
+    if (_predicate.is_between()) return BETWEEN_SELECTIVITY;
+    switch (_predicate.scan_type()) {
+      case ScanType::OpEquals:
+        return EQUALS_SELECTIVITY;
+      case ScanType::OpNotEquals:
+        return NOT_EQUALS_SELECTIVITY;
+      default:
+        return RANGE_SELECTIVITY;
+    }
+  }
+
+  void scan_segment(const BaseSegment& segment, SegmentScanState& state,
+                    std::vector<ChunkOffset>& matches) const final {
+    // BETWEEN predicates scan for their lower value and then check both values of the matches
+    _table_scan_impl.scan_segment(segment, matches);
+    if (_predicate.is_between()) filter_segment(segment, state, matches);
+  }
+
+  void filter_segment(const BaseSegment& segment, SegmentScanState&,
+                      std::vector<ChunkOffset>& positions) const final {
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      _filter_dictionary_segment(*dictionary_segment, positions);
+      return;
+    }
+
+    // equality is checked on the compressed values, like TableScanImpl does
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto fsst_segment = dynamic_cast<const FSSTSegment*>(&segment);
+      const auto scan_type = _predicate.scan_type();
+      if (fsst_segment && !_predicate.is_between() &&
+          (scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals)) {
+        const auto compressed_value = fsst_segment->compress(_value);
+        const auto negated = scan_type == ScanType::OpNotEquals;
+        retain_positions(positions, [&](const ChunkOffset position) {
+          return fsst_segment->equals(position, compressed_value) != negated;
+        });
+        return;
+      }
+    }
+
+    _resolve_predicate([&](const auto& predicate) { filter_values<T>(segment, positions, predicate); });
+  }
+
+ protected:
+  // the value ids that satisfy the predicate are [begin, end), or all others if negated is set
+  struct ValueIDRange {
+    uint32_t begin;
+    uint32_t end;
+    bool negated;
+  };
+
+  ValueIDRange _value_id_range(const DictionarySegment<T>& segment) const {
+    const auto dictionary_size = static_cast<uint32_t>(segment.unique_values_count());
+    const auto to_bound = [&](const ValueID value_id) {
+      return value_id == INVALID_VALUE_ID ? dictionary_size : static_cast<uint32_t>(value_id);
+    };
+    const auto lower_bound = to_bound(segment.lower_bound(_value));
+    const auto upper_bound = to_bound(segment.upper_bound(_value));
+
+    if (_predicate.is_between()) {
+      return {lower_bound, std::max(lower_bound, to_bound(segment.upper_bound(_upper_value))), false};
+    }
+    auto range = ValueIDRange{lower_bound, upper_bound, false};
+    switch (_predicate.scan_type()) {
+      case ScanType::OpEquals:
+        break;
+      case ScanType::OpNotEquals:
+        range.negated = true;
+        break;
+      case ScanType::OpLessThan:
+        range = {0, lower_bound, false};
+        break;
+      case ScanType::OpLessThanEquals:
+        range = {0, upper_bound, false};
+        break;
+      case ScanType::OpGreaterThan:
+        range = {upper_bound, dictionary_size, false};
+        break;
+      case ScanType::OpGreaterThanEquals:
+        range = {lower_bound, dictionary_size, false};
+        break;
+    }
+    return range;
+  }
+
+  void _filter_dictionary_segment(const DictionarySegment<T>& segment, std::vector<ChunkOffset>& positions) const {
+    const auto range = _value_id_range(segment);
+    filter_value_ids(*segment.attribute_vector(), positions, [&](const uint32_t value_id) {
+      return (value_id >= range.begin && value_id < range.end) != range.negated;
+    });
+  }
+
+  // calls functor with a function that returns whether a value satisfies the predicate
+  template <typename Functor>
+  void _resolve_predicate(const Functor& functor) const {
+    if (_predicate.is_between()) {
+      return functor([&](const T& value) { return _value <= value && value <= _upper_value; });
+    }
+
+    const auto compare_with_value = [&](const auto& comparator) {
+      functor([&](const T& value) { return comparator(value, _value); });
+    };
+    switch (_predicate.scan_type()) {
+      case ScanType::OpEquals:
+        return compare_with_value(std::equal_to<T>{});
+      case ScanType::OpNotEquals:
+        return compare_with_value(std::not_equal_to<T>{});
+      case ScanType::OpLessThan:
+        return compare_with_value(std::less<T>{});
+      case ScanType::OpLessThanEquals:
+        return compare_with_value(std::less_equal<T>{});
+      case ScanType::OpGreaterThan:
+        return compare_with_value(std::greater<T>{});
+      case ScanType::OpGreaterThanEquals:
+        return compare_with_value(std::greater_equal<T>{});
+    }
+    Fail("Unknown scan type");
+  }
+
+  const ScanPredicate _predicate;
+  const T _value;
+  const T _upper_value;
+  const TableScanImpl<T> _table_scan_impl;
+};
+
+// Evaluates `column IN (values)`. Dictionary segments translate the list into a bitmap of value ids once per chunk, so
+// that each row costs a single lookup. Other segments compare the rows with short lists using the scan kernels and
+// probe longer lists in a hash set.
+template <typename T>
+class InListScanner : public BasePredicateScanner {
+ public:
+  explicit InListScanner(const ScanPredicate& predicate)
+      : _predicate(predicate), _values(_typed_values(predicate)), _value_set(_values) {}
+
+  bool can_prune(const Chunk& chunk) const final {
+    const auto& values = _predicate.in_values();
+    return std::all_of(values.cbegin(), values.cend(), [&](const AllTypeVariant& value) {
+      return chunk.can_prune(_predicate.column_id(), ScanType::OpEquals, value);
+    });
+  }
+
+  float estimate_selectivity(const BaseSegment& segment, SegmentScanState& state) const final {
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      const auto& value_id_bitmap = _value_id_bitmap(*dictionary_segment, state);
+      const auto matching_value_count = std::count(value_id_bitmap.cbegin(), value_id_bitmap.cend(), true);
+      return static_cast<float>(matching_value_count) / static_cast<float>(value_id_bitmap.size());
+    }
+    return std::min(1.0f, EQUALS_SELECTIVITY * static_cast<float>(_values.size()));
+  }
+
+  void scan_segment(const BaseSegment& segment, SegmentScanState& state,
+                    std::vector<ChunkOffset>& matches) const final {
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      const auto& value_id_bitmap = _value_id_bitmap(*dictionary_segment, state);
+      if (std::find(value_id_bitmap.cbegin(), value_id_bitmap.cend(), true) == value_id_bitmap.cend()) return;
+      scan_value_ids(*dictionary_segment->attribute_vector(), matches,
+                     [&](const uint32_t value_id) { return value_id_bitmap[value_id]; });
+      return;
+    }
+
+    if constexpr (std::is_arithmetic_v<T>) {
+      const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment);
+      if (value_segment && _values.size() <= KERNEL_IN_LIST_MAX_SIZE) {
+        const auto values = value_segment->values();
+        scan_values_in(values.data(), values.size(), _values, matches);
+        return;
+      }
+    }
+
+    if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+      run_length_segment->for_each_run([&](const T& value, const ChunkOffset begin, const ChunkOffset end) {
+        if (!_value_set.contains(value)) return;
+        for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) matches.push_back(chunk_offset);
+      });
+      return;
+    }
+
+    segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+      if (_value_set.contains(value)) matches.push_back(chunk_offset);
+    });
+  }
+
+  void filter_segment(const BaseSegment& segment, SegmentScanState& state,
+                      std::vector<ChunkOffset>& positions) const final {
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      const auto& value_id_bitmap = _value_id_bitmap(*dictionary_segment, state);
+      filter_value_ids(*dictionary_segment->attribute_vector(), positions,
+                       [&](const uint32_t value_id) { return value_id_bitmap[value_id]; });
+      return;
+    }
+
+    filter_values<T>(segment, positions, [&](const T& value) { return _value_set.contains(value); });
+  }
+
+ protected:
+  // returns the values of the list converted to T, sorted and without duplicates
+  static std::vector<T> _typed_values(const ScanPredicate& predicate) {
+    auto values = std::vector<T>{};
+    values.reserve(predicate.in_values().size());
+    for (const auto& value : predicate.in_values()) values.push_back(type_cast<T>(value));
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+  }
+
+  // Returns a bitmap that has a bit set for the value ids of the values in the list that are in the dictionary. It is
+  // built on the first call for a segment and kept in its state.
+  const std::vector<bool>& _value_id_bitmap(const DictionarySegment<T>& segment, SegmentScanState& state) const {
+    if (state.value_id_bitmap) return *state.value_id_bitmap;
+
+    auto& value_id_bitmap = state.value_id_bitmap.emplace(segment.unique_values_count());
+    for (const auto& value : _values) {
+      const auto value_id = segment.lower_bound(value);
+      // the lower bound is the value itself if the dictionary contains it
+      if (value_id != INVALID_VALUE_ID && segment.value_by_value_id(value_id) == value) {
+        value_id_bitmap[value_id] = true;
+      }
+    }
+    return value_id_bitmap;
+  }
+
+  const ScanPredicate _predicate;
+  const std::vector<T> _values;
+  const InListHashSet<T> _value_set;
+};
+
+}  // namespace
+
+ScanPredicate::ScanPredicate(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value)
+    : _column_id(column_id), _scan_type(scan_type), _value(value) {}
+
+ScanPredicate ScanPredicate::between(const ColumnID column_id, const AllTypeVariant& lower_value,
+                                     const AllTypeVariant& upper_value) {
+  auto predicate = ScanPredicate{column_id, ScanType::OpGreaterThanEquals, lower_value};
+  predicate._upper_value = upper_value;
+  return predicate;
+}
+
+ScanPredicate ScanPredicate::in(const ColumnID column_id, std::vector<AllTypeVariant> values) {
+  auto predicate = ScanPredicate{column_id, ScanType::OpEquals, AllTypeVariant{}};
+  predicate._in_values = std::move(values);
+  return predicate;
+}
+
+ColumnID ScanPredicate::column_id() const { return _column_id; }
+
+ScanType ScanPredicate::scan_type() const {
+  DebugAssert(!is_in(), "IN predicates have no scan type");
+  return _scan_type;
+}
+
+const AllTypeVariant& ScanPredicate::value() const {
+  DebugAssert(!is_in(), "IN predicates have no single value");
+  return _value;
+}
+
+bool ScanPredicate::is_between() const { return _upper_value.has_value(); }
+
+const AllTypeVariant& ScanPredicate::upper_value() const {
+  DebugAssert(is_between(), "Only BETWEEN predicates have an upper value");
+  return *_upper_value;
+}
+
+bool ScanPredicate::is_in() const { return _in_values.has_value(); }
+
+const std::vector<AllTypeVariant>& ScanPredicate::in_values() const {
+  DebugAssert(is_in(), "Only IN predicates have a list of values");
+  return *_in_values;
+}
+
+ConjunctiveTableScan::ConjunctiveTableScan(const std::shared_ptr<const AbstractOperator> in,
+                                           std::vector<ScanPredicate> predicates)
+    : AbstractOperator(in), _predicates(std::move(predicates)) {
+  Assert(!_predicates.empty(), "ConjunctiveTableScan needs at least one predicate");
+}
+
+ConjunctiveTableScan::~ConjunctiveTableScan() = default;
+
+const std::vector<ScanPredicate>& ConjunctiveTableScan::predicates() const { return _predicates; }
+
+std::shared_ptr<const Table> ConjunctiveTableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  auto scanners = std::vector<std::unique_ptr<BasePredicateScanner>>{};
+  for (const auto& predicate : _predicates) {
+    const auto& column_type = input_table->column_type(predicate.column_id());
+    if (predicate.is_in()) {
+      scanners.push_back(make_unique_by_data_type<BasePredicateScanner, InListScanner>(column_type, predicate));
+    } else {
+      scanners.push_back(make_unique_by_data_type<BasePredicateScanner, PredicateScanner>(column_type, predicate));
+    }
+  }
+
+  // chunks may be scanned in parallel, so the selectivities and the predicate order are kept per chunk
+  return scan_table(input_table, [&](const Chunk& chunk, std::vector<ChunkOffset>& positions) {
+    const auto can_prune = [&](const auto& scanner) { return scanner->can_prune(chunk); };
+    if (std::any_of(scanners.cbegin(), scanners.cend(), can_prune)) return;
+
+    const auto segment = [&](const size_t predicate_index) -> const BaseSegment& {
+      return *chunk.get_segment(_predicates[predicate_index].column_id());
+    };
+    auto states = std::vector<SegmentScanState>(scanners.size());
+    auto selectivities = std::vector<float>(scanners.size());
+    for (auto predicate_index = size_t{0}; predicate_index < scanners.size(); ++predicate_index) {
+      selectivities[predicate_index] =
+          scanners[predicate_index]->estimate_selectivity(segment(predicate_index), states[predicate_index]);
+    }
+    auto predicate_order = std::vector<size_t>(scanners.size());
+    std::iota(predicate_order.begin(), predicate_order.end(), size_t{0});
+    std::stable_sort(predicate_order.begin(), predicate_order.end(),
+                     [&](const size_t lhs, const size_t rhs) { return selectivities[lhs] < selectivities[rhs]; });
+
+    const auto first_predicate_index = predicate_order.front();
+    scanners[first_predicate_index]->scan_segment(segment(first_predicate_index), states[first_predicate_index],
+                                                  positions);
+    for (auto order_index = size_t{1}; order_index < predicate_order.size() && !positions.empty(); ++order_index) {
+      const auto predicate_index = predicate_order[order_index];
+      scanners[predicate_index]->filter_segment(segment(predicate_index), states[predicate_index], positions);
+    }
+  });
+}
+
+}  // namespace opossum
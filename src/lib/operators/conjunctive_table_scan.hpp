@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// A predicate of a ConjunctiveTableScan, i.e., `column <scan_type> value`, `lower_value <= column <= upper_value` or
+// `column IN (values)`
+class ScanPredicate {
+ public:
+  ScanPredicate(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value);
+
+  // creates a BETWEEN predicate, both bounds are inclusive
+  static ScanPredicate between(const ColumnID column_id, const AllTypeVariant& lower_value,
+                               const AllTypeVariant& upper_value);
+
+  // creates an IN predicate, which matches the rows that are equal to any of the values
+  static ScanPredicate in(const ColumnID column_id, std::vector<AllTypeVariant> values);
+
+  ColumnID column_id() const;
+
+  // the scan type of BETWEEN predicates is OpGreaterThanEquals, for their lower value. IN predicates have neither a
+  // scan type nor a value.
+  ScanType scan_type() const;
+  const AllTypeVariant& value() const;
+
+  bool is_between() const;
+  const AllTypeVariant& upper_value() const;
+
+  bool is_in() const;
+  const std::vector<AllTypeVariant>& in_values() const;
+
+ protected:
+  ColumnID _column_id;
+  ScanType _scan_type;
+  AllTypeVariant _value;
+  std::optional<AllTypeVariant> _upper_value;
+  std::optional<std::vector<AllTypeVariant>> _in_values;
+};
+
+// Selects the rows that satisfy all of the predicates, e.g., `a >= 10 AND a < 20 AND b = 'x'`, in one pass per chunk.
+// Unlike a chain of TableScans, it creates no intermediate tables and reads each segment directly instead of through
+// ReferenceSegments. Per chunk, the predicates are evaluated in the order of their estimated selectivity: the first one
+// scans the whole segment, the others only check the rows that are still selected.
+class ConjunctiveTableScan : public AbstractOperator {
+ public:
+  ConjunctiveTableScan(const std::shared_ptr<const AbstractOperator> in, std::vector<ScanPredicate> predicates);
+
+  ~ConjunctiveTableScan();
+
+  const std::vector<ScanPredicate>& predicates() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<ScanPredicate> _predicates;
+};
+
+}  // namespace opossum
@@ -0,0 +1,223 @@
+#include "like_table_scan.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>  // NOLINT(build/include_order)
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "table_scan_impl.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A parsed LIKE pattern. Patterns without `_` that are a plain string, a prefix, a suffix or a substring are matched
+// with a single comparison or substring search, all others with the general algorithm.
+class LikePattern {
+ public:
+  enum class Kind { Exact, Prefix, Suffix, Contains, Wildcard };
+
+  explicit LikePattern(const std::string& pattern) {
+    // the pattern is split at the `%`s, e.g., `a%b_c%` into "a", "b_c" and ""
+    auto begin = size_t{0};
+    while (true) {
+      const auto end = pattern.find('%', begin);
+      _pieces.push_back(pattern.substr(begin, end - begin));
+      if (end == std::string::npos) break;
+      begin = end + 1;
+    }
+
+    _kind = Kind::Wildcard;
+    if (pattern.find('_') != std::string::npos) return;
+    const auto piece_count = _pieces.size();
+    if (piece_count == 1) _kind = Kind::Exact;
+    if (piece_count == 2 && _pieces.back().empty()) _kind = Kind::Prefix;
+    if (piece_count == 2 && !_pieces.back().empty() && _pieces.front().empty()) _kind = Kind::Suffix;
+    if (piece_count == 3 && _pieces.front().empty() && _pieces.back().empty()) _kind = Kind::Contains;
+  }
+
+  Kind kind() const { return _kind; }
+
+  // the string of Exact and Prefix patterns
+  const std::string& prefix() const { return _pieces.front(); }
+
+  bool matches(const std::string_view value) const {
+    switch (_kind) {
+      case Kind::Exact:
+        return value == _pieces.front();
+      case Kind::Prefix:
+        return value.substr(0, _pieces.front().size()) == _pieces.front();
+      case Kind::Suffix:
+        return value.size() >= _pieces.back().size() &&
+               value.substr(value.size() - _pieces.back().size()) == _pieces.back();
+      case Kind::Contains:
+        return _find(value, 0, value.size(), _pieces[1]) != std::string_view::npos;
+      case Kind::Wildcard:
+        break;
+    }
+    return _matches_wildcard(value);
+  }
+
+ protected:
+  // The first piece has to match at the beginning of the value and the last one at its end. Each piece in between is
+  // matched at its first occurrence after the previous one, which never rules out a match that a later one allows.
+  bool _matches_wildcard(const std::string_view value) const {
+    const auto& first_piece = _pieces.front();
+    if (!_matches_at(value, 0, first_piece)) return false;
+    if (_pieces.size() == 1) return value.size() == first_piece.size();
+
+    const auto& last_piece = _pieces.back();
+    if (value.size() < first_piece.size() + last_piece.size()) return false;
+    const auto end = value.size() - last_piece.size();
+    if (!_matches_at(value, end, last_piece)) return false;
+
+    auto position = first_piece.size();
+    for (auto piece_index = size_t{1}; piece_index + 1 < _pieces.size(); ++piece_index) {
+      const auto found_position = _find(value, position, end, _pieces[piece_index]);
+      if (found_position == std::string_view::npos) return false;
+      position = found_position + _pieces[piece_index].size();
+    }
+    return true;
+  }
+
+  // returns whether the piece, which may contain `_`, matches the value at the position
+  static bool _matches_at(const std::string_view value, const size_t position, const std::string& piece) {
+    if (position + piece.size() > value.size()) return false;
+    for (auto index = size_t{0}; index < piece.size(); ++index) {
+      if (piece[index] != '_' && piece[index] != value[position + index]) return false;
+    }
+    return true;
+  }
+
+  // returns the first position in [begin, end) at which the piece matches, or npos. Pieces without `_` are found with
+  // memmem, which uses a vectorized substring search.
+  static size_t _find(const std::string_view value, const size_t begin, const size_t end, const std::string& piece) {
+    if (begin + piece.size() > end) return std::string_view::npos;
+    if (piece.find('_') == std::string::npos) {
+      const auto found =
+          static_cast<const char*>(memmem(value.data() + begin, end - begin, piece.data(), piece.size()));
+      return found ? static_cast<size_t>(found - value.data()) : std::string_view::npos;
+    }
+
+    for (auto position = begin; position + piece.size() <= end; ++position) {
+      if (_matches_at(value, position, piece)) return position;
+    }
+    return std::string_view::npos;
+  }
+
+  std::vector<std::string> _pieces;
+  Kind _kind;
+};
+
+// returns the smallest string that is greater than all strings that start with the prefix, or nullopt if there is none
+std::optional<std::string> prefix_successor(std::string prefix) {
+  while (!prefix.empty() && static_cast<unsigned char>(prefix.back()) == 0xFF) prefix.pop_back();
+  if (prefix.empty()) return std::nullopt;
+  prefix.back() = static_cast<char>(static_cast<unsigned char>(prefix.back()) + 1);
+  return prefix;
+}
+
+bool can_prune(const Chunk& chunk, const ColumnID column_id, const LikePattern& pattern) {
+  if (pattern.kind() == LikePattern::Kind::Exact) {
+    return chunk.can_prune(column_id, ScanType::OpEquals, pattern.prefix());
+  }
+  if (pattern.kind() != LikePattern::Kind::Prefix) return false;
+
+  if (chunk.can_prune(column_id, ScanType::OpGreaterThanEquals, pattern.prefix())) return true;
+  const auto successor = prefix_successor(pattern.prefix());
+  return successor && chunk.can_prune(column_id, ScanType::OpLessThan, *successor);
+}
+
+void scan_dictionary_segment(const DictionarySegment<std::string>& segment, const LikePattern& pattern,
+                             std::vector<ChunkOffset>& matches) {
+  const auto dictionary_size = static_cast<uint32_t>(segment.unique_values_count());
+  const auto& attribute_vector = *segment.attribute_vector();
+
+  if (pattern.kind() == LikePattern::Kind::Exact || pattern.kind() == LikePattern::Kind::Prefix) {
+    // the matching values are a range of the sorted dictionary
+    const auto to_bound = [&](const ValueID value_id) {
+      return value_id == INVALID_VALUE_ID ? dictionary_size : static_cast<uint32_t>(value_id);
+    };
+    const auto begin = to_bound(segment.lower_bound(pattern.prefix()));
+    auto end = dictionary_size;
+    if (pattern.kind() == LikePattern::Kind::Exact) {
+      end = to_bound(segment.upper_bound(pattern.prefix()));
+    } else {
+      const auto successor = prefix_successor(pattern.prefix());
+      if (successor) end = to_bound(segment.lower_bound(*successor));
+    }
+
+    if (begin >= end) return;
+    if (begin == 0 && end == dictionary_size) {
+      const auto first_match = matches.size();
+      matches.resize(first_match + segment.size());
+      std::iota(matches.begin() + first_match, matches.end(), ChunkOffset{0});
+      return;
+    }
+    scan_value_ids(attribute_vector, matches,
+                   [&](const uint32_t value_id) { return value_id >= begin && value_id < end; });
+    return;
+  }
+
+  auto value_id_bitmap = std::vector<bool>(dictionary_size);
+  segment.dictionary()->for_each(
+      [&](const size_t value_id, const std::string& value) { value_id_bitmap[value_id] = pattern.matches(value); });
+  if (std::find(value_id_bitmap.cbegin(), value_id_bitmap.cend(), true) == value_id_bitmap.cend()) return;
+  scan_value_ids(attribute_vector, matches, [&](const uint32_t value_id) { return value_id_bitmap[value_id]; });
+}
+
+void scan_segment(const BaseSegment& segment, const LikePattern& pattern, std::vector<ChunkOffset>& matches) {
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<std::string>*>(&segment)) {
+    scan_dictionary_segment(*dictionary_segment, pattern, matches);
+    return;
+  }
+
+  const auto fsst_segment = dynamic_cast<const FSSTSegment*>(&segment);
+  if (fsst_segment && pattern.kind() == LikePattern::Kind::Exact) {
+    scan_fsst_segment_for_equality(*fsst_segment, pattern.prefix(), false, matches);
+    return;
+  }
+
+  if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<std::string>*>(&segment)) {
+    run_length_segment->for_each_run([&](const std::string& value, const ChunkOffset begin, const ChunkOffset end) {
+      if (!pattern.matches(value)) return;
+      for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) matches.push_back(chunk_offset);
+    });
+    return;
+  }
+
+  segment_iterate<std::string>(segment, [&](const std::string& value, const ChunkOffset chunk_offset) {
+    if (pattern.matches(value)) matches.push_back(chunk_offset);
+  });
+}
+
+}  // namespace
+
+LikeTableScan::LikeTableScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+                             const std::string& pattern)
+    : AbstractOperator(in), _column_id(column_id), _pattern(pattern) {}
+
+LikeTableScan::~LikeTableScan() = default;
+
+ColumnID LikeTableScan::column_id() const { return _column_id; }
+
+const std::string& LikeTableScan::pattern() const { return _pattern; }
+
+std::shared_ptr<const Table> LikeTableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(input_table->column_type(_column_id) == "string", "LIKE can only be evaluated on string columns");
+  const auto pattern = LikePattern{_pattern};
+
+  return scan_table(input_table, [&](const Chunk& chunk, std::vector<ChunkOffset>& matches) {
+    if (can_prune(chunk, _column_id, pattern)) return;
+    scan_segment(*chunk.get_segment(_column_id), pattern, matches);
+  });
+}
+
+}  // namespace opossum
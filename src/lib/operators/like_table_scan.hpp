@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Selects the rows of a string column that match a LIKE pattern, in which `%` matches any sequence of characters and
+// `_` matches any single byte. There is no escape character.
+class LikeTableScan : public AbstractOperator {
+ public:
+  LikeTableScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const std::string& pattern);
+
+  ~LikeTableScan();
+
+  ColumnID column_id() const;
+  const std::string& pattern() const;
+
+ protected:
+  // Patterns are evaluated once per distinct value of DictionarySegments, whose rows are then matched by value id.
+  // Prefix patterns (`abc%`) become a range of value ids and also use the segment filters to prune chunks.
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const std::string _pattern;
+};
+
+}  // namespace opossum
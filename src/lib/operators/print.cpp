@@ -41,22 +41,22 @@ std::shared_ptr<const Table> Print::_on_execute() {
 
   // print each chunk
   for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
-    const auto& chunk = _input_table_left()->get_chunk(chunk_id);
+    const auto chunk = _input_table_left()->get_chunk_ptr(chunk_id);
 
     _out << "=== Chunk " << chunk_id << " === " << std::endl;
 
-    if (chunk.size() == 0) {
+    if (chunk->size() == 0) {
       _out << "Empty chunk." << std::endl;
       continue;
     }
 
     // print the rows in the chunk
-    for (size_t row = 0; row < chunk.size(); ++row) {
+    for (size_t row = 0; row < chunk->size(); ++row) {
       _out << "|";
-      for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+      for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
         // well yes, we use BaseSegment::operator[] here, but since Print is not an operation that should
         // be part of a regular query plan, let's keep things simple here
-        _out << std::setw(widths[column_id]) << (*chunk.get_segment(column_id))[row] << "|" << std::setw(0);
+        _out << std::setw(widths[column_id]) << (*chunk->get_segment(column_id))[row] << "|" << std::setw(0);
       }
 
       _out << std::endl;
@@ -78,12 +78,12 @@ std::vector<uint16_t> Print::column_string_widths(uint16_t min, uint16_t max, st
 
   // go over all rows and find the maximum length of the printed representation of a value, up to max
   for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
-    auto& chunk = _input_table_left()->get_chunk(chunk_id);
+    const auto chunk = _input_table_left()->get_chunk_ptr(chunk_id);
 
-    for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
-      for (size_t row = 0; row < chunk.size(); ++row) {
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      for (size_t row = 0; row < chunk->size(); ++row) {
         auto cell_length =
-            static_cast<uint16_t>(boost::lexical_cast<std::string>((*chunk.get_segment(column_id))[row]).size());
+            static_cast<uint16_t>(boost::lexical_cast<std::string>((*chunk->get_segment(column_id))[row]).size());
         widths[column_id] = std::max({min, widths[column_id], std::min(max, cell_length)});
       }
     }
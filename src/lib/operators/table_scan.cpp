@@ -0,0 +1,40 @@
+#include "table_scan.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "table_scan_impl.hpp"
+
+namespace opossum {
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+TableScan::~TableScan() = default;
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+void TableScan::set_parallelism(const ScanParallelism& parallelism) { _parallelism = parallelism; }
+
+const ScanParallelism& TableScan::parallelism() const { return _parallelism; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto impl = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(input_table->column_type(_column_id),
+                                                                               _scan_type, _search_value);
+
+  const auto scan_chunk = [&](const Chunk& chunk, std::vector<ChunkOffset>& matches) {
+    if (chunk.can_prune(_column_id, _scan_type, _search_value)) return;
+    impl->scan_segment(*chunk.get_segment(_column_id), matches);
+  };
+  return scan_table(input_table, scan_chunk, _parallelism);
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
@@ -15,6 +16,16 @@ namespace opossum {
 class BaseTableScanImpl;
 class Table;
 
+// Controls how many chunks of a table are scanned in parallel on the WorkerPool
+struct ScanParallelism {
+  // tables with fewer rows are scanned on the calling thread, as scheduling tasks would cost more than it saves
+  size_t min_row_count = 100'000;
+
+  // the maximum number of chunks that are scanned at the same time, which is also bounded by the number of threads
+  // that execute the WorkerPool's tasks
+  size_t max_degree = std::numeric_limits<size_t>::max();
+};
+
 class TableScan : public AbstractOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
@@ -26,8 +37,19 @@ class TableScan : public AbstractOperator {
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
 
+  void set_parallelism(const ScanParallelism& parallelism);
+  const ScanParallelism& parallelism() const;
+
  protected:
+  // Scans the input chunk by chunk, in parallel for large tables. Chunks whose segment filters (e.g., zone maps) rule
+  // out any match are skipped. The output consists of ReferenceSegments that point to the rows of the original
+  // (non-reference) table.
   std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+  ScanParallelism _parallelism;
 };
 
 }  // namespace opossum
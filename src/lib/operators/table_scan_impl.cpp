@@ -0,0 +1,141 @@
+#include "table_scan_impl.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/pos_list_utils.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/worker_pool.hpp"
+
+namespace opossum {
+
+void scan_fsst_segment_for_equality(const FSSTSegment& segment, const std::string& value, const bool negated,
+                                    std::vector<ChunkOffset>& matches) {
+  const auto compressed_value = segment.compress(value);
+  const auto size = static_cast<ChunkOffset>(segment.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    if (segment.equals(chunk_offset, compressed_value) != negated) matches.push_back(chunk_offset);
+  }
+}
+
+std::shared_ptr<const Table> scan_table(const std::shared_ptr<const Table>& input_table, const ChunkScan& scan_chunk,
+                                        const ScanParallelism& parallelism) {
+  auto output_table = std::make_shared<Table>(input_table->max_chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  const auto chunk_count = input_table->chunk_count();
+  auto scanned_chunks = std::vector<std::optional<Chunk>>(chunk_count);
+  const auto scan = [&](const ChunkID chunk_id, std::vector<ChunkOffset>& matches) {
+    // the chunk may be replaced by a compressed version while it is scanned
+    const auto chunk = input_table->get_chunk_ptr(chunk_id);
+    if (chunk->size() == 0) return;
+
+    matches.clear();
+    scan_chunk(*chunk, matches);
+    if (matches.empty()) return;
+
+    scanned_chunks[chunk_id].emplace(make_reference_chunk(input_table, chunk_id, *chunk, matches));
+  };
+
+  // the calling thread executes tasks as well while it waits for them
+  auto& worker_pool = WorkerPool::get();
+  const auto task_count = std::min({parallelism.max_degree, worker_pool.worker_count() + 1, size_t{chunk_count}});
+  if (task_count < 2 || input_table->row_count() < parallelism.min_row_count) {
+    auto matches = std::vector<ChunkOffset>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) scan(chunk_id, matches);
+  } else {
+    // chunks are handed out one at a time, so that tasks that happen to scan cheap chunks take over more of them
+    auto next_chunk_id = std::atomic<ChunkID::base_type>{0};
+    auto tasks = std::vector<std::function<void()>>{};
+    tasks.reserve(task_count);
+    for (auto task_index = size_t{0}; task_index < task_count; ++task_index) {
+      tasks.emplace_back([&]() {
+        auto matches = std::vector<ChunkOffset>{};
+        for (auto chunk_id = next_chunk_id++; chunk_id < chunk_count; chunk_id = next_chunk_id++) {
+          scan(ChunkID{chunk_id}, matches);
+        }
+      });
+    }
+    worker_pool.execute_and_wait(std::move(tasks));
+  }
+
+  auto output_chunks = std::vector<Chunk>{};
+  for (auto& scanned_chunk : scanned_chunks) {
+    if (scanned_chunk) output_chunks.push_back(std::move(*scanned_chunk));
+  }
+
+  // even an empty result needs segments, so that its columns can be accessed
+  const auto first_chunk = input_table->get_chunk_ptr(ChunkID{0});
+  if (output_chunks.empty() && first_chunk->column_count() == input_table->column_count()) {
+    output_chunks.push_back(make_reference_chunk(input_table, ChunkID{0}, *first_chunk, {}));
+  }
+
+  output_table->emplace_chunks(std::move(output_chunks));
+  return output_table;
+}
+
+Chunk make_reference_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                           const Chunk& input_chunk, const std::vector<ChunkOffset>& matches) {
+  auto output_chunk = Chunk{};
+
+  auto own_pos_list = std::shared_ptr<const AbstractPosList>{};
+  auto resolved_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
+
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    const auto segment = input_chunk.get_segment(column_id);
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      auto& resolved_pos_list = resolved_pos_lists[reference_segment->pos_list()];
+      if (!resolved_pos_list) resolved_pos_list = resolve_pos_list(*reference_segment->pos_list(), matches);
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+          reference_segment->referenced_table(), reference_segment->referenced_column_id(), resolved_pos_list));
+    } else {
+      if (!own_pos_list) own_pos_list = make_single_chunk_pos_list(chunk_id, matches);
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, own_pos_list));
+    }
+  }
+
+  return output_chunk;
+}
+
+std::shared_ptr<const AbstractPosList> resolve_pos_list(const AbstractPosList& input_pos_list,
+                                                        const std::vector<ChunkOffset>& matches) {
+  auto pos_list = std::shared_ptr<const AbstractPosList>{};
+  resolve_pos_list_type(input_pos_list, [&](const auto& typed_pos_list) {
+    using PosListType = std::decay_t<decltype(typed_pos_list)>;
+    if constexpr (std::is_same_v<PosListType, PosList>) {
+      auto row_ids = std::make_shared<PosList>();
+      row_ids->reserve(matches.size());
+      for (const auto chunk_offset : matches) row_ids->push_back(typed_pos_list[chunk_offset]);
+      if (typed_pos_list.references_single_chunk()) row_ids->guarantee_single_chunk();
+      pos_list = row_ids;
+    } else {
+      // sorted positions in a single chunk stay sorted, so the result can be compressed again
+      auto chunk_offsets = std::vector<ChunkOffset>{};
+      chunk_offsets.reserve(matches.size());
+      if constexpr (std::is_same_v<PosListType, RangePosList>) {
+        for (const auto chunk_offset : matches) chunk_offsets.push_back(typed_pos_list.begin_offset() + chunk_offset);
+      } else {
+        auto match = matches.cbegin();
+        typed_pos_list.for_each([&](const size_t index, const RowID& row_id) {
+          if (match == matches.cend() || *match != index) return;
+          chunk_offsets.push_back(row_id.chunk_offset);
+          ++match;
+        });
+      }
+      pos_list = make_single_chunk_pos_list(typed_pos_list.chunk_id(), chunk_offsets);
+    }
+  });
+  return pos_list;
+}
+
+}  // namespace opossum
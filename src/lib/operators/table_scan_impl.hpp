@@ -0,0 +1,295 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "table_scan.hpp"
+#include "table_scan_kernels.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/bit_packing.hpp"
+
+// Building blocks shared by the scan operators
+
+namespace opossum {
+
+class Table;
+
+// attribute vectors that are not stored with a fixed size are decoded this many value ids at a time
+constexpr auto DECODE_BLOCK_SIZE = ChunkOffset{2048};
+
+// appends the offsets of all rows whose value id satisfies matches_value_id(value_id) to matches
+template <typename Predicate>
+void scan_value_ids(const BaseAttributeVector& attribute_vector, std::vector<ChunkOffset>& matches,
+                    const Predicate& matches_value_id) {
+  const auto size = static_cast<ChunkOffset>(attribute_vector.size());
+  auto scanned = false;
+  const auto scan_fixed_size_value_ids = [&](const auto* fixed_size_attribute_vector) {
+    if (!fixed_size_attribute_vector) return;
+    const auto& value_ids = fixed_size_attribute_vector->values();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      if (matches_value_id(value_ids[chunk_offset])) matches.push_back(chunk_offset);
+    }
+    scanned = true;
+  };
+  scan_fixed_size_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(&attribute_vector));
+  scan_fixed_size_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(&attribute_vector));
+  scan_fixed_size_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(&attribute_vector));
+  if (scanned) return;
+
+  auto value_ids = std::vector<ValueID>{};
+  for (auto begin = ChunkOffset{0}; begin < size; begin += DECODE_BLOCK_SIZE) {
+    const auto end = std::min(size, begin + DECODE_BLOCK_SIZE);
+    attribute_vector.decode(begin, end, value_ids);
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      if (matches_value_id(value_ids[chunk_offset - begin])) matches.push_back(chunk_offset);
+    }
+  }
+}
+
+// Appends the offsets of the rows of an FSST segment that are equal to value, or not equal if negated is set. The value
+// is compressed once and compared with the compressed rows, which are not decompressed.
+void scan_fsst_segment_for_equality(const FSSTSegment& segment, const std::string& value, const bool negated,
+                                    std::vector<ChunkOffset>& matches);
+
+// Scans single segments of the scanned column. It is implemented per data type so that values can be compared without
+// going through AllTypeVariant and so that each segment type can be scanned in its own representation.
+class BaseTableScanImpl {
+ public:
+  virtual ~BaseTableScanImpl() = default;
+
+  // appends the offsets of all rows of the segment that satisfy the predicate to matches
+  virtual void scan_segment(const BaseSegment& segment, std::vector<ChunkOffset>& matches) const = 0;
+};
+
+template <typename T>
+class TableScanImpl : public BaseTableScanImpl {
+ public:
+  TableScanImpl(const ScanType scan_type, const AllTypeVariant& search_value)
+      : _scan_type(scan_type), _search_value(type_cast<T>(search_value)) {}
+
+  void scan_segment(const BaseSegment& segment, std::vector<ChunkOffset>& matches) const override {
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+        const auto values = value_segment->values();
+        scan_values(values.data(), values.size(), _scan_type, _search_value, matches);
+        return;
+      }
+    }
+
+    // only integer columns can be frame-of-reference encoded
+    if constexpr (std::is_integral_v<T>) {
+      if (const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+        _scan_frame_of_reference_segment(*frame_of_reference_segment, matches);
+        return;
+      }
+    }
+
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      _scan_dictionary_segment(*dictionary_segment, matches);
+      return;
+    }
+
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto fsst_segment = dynamic_cast<const FSSTSegment*>(&segment);
+      if (fsst_segment && (_scan_type == ScanType::OpEquals || _scan_type == ScanType::OpNotEquals)) {
+        scan_fsst_segment_for_equality(*fsst_segment, _search_value, _scan_type == ScanType::OpNotEquals, matches);
+        return;
+      }
+    }
+
+    _resolve_comparator([&](const auto& comparator) {
+      const auto matches_value = [&](const T& value) { return comparator(value, _search_value); };
+
+      if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+        run_length_segment->for_each_run([&](const T& value, const ChunkOffset begin, const ChunkOffset end) {
+          if (!matches_value(value)) return;
+          for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) matches.push_back(chunk_offset);
+        });
+      } else {
+        segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+          if (matches_value(value)) matches.push_back(chunk_offset);
+        });
+      }
+    });
+  }
+
+ protected:
+  // calls functor with the comparator of the scan type, so that the scan loops are instantiated once per comparator
+  template <typename Functor>
+  void _resolve_comparator(const Functor& functor) const {
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return functor(std::equal_to<T>{});
+      case ScanType::OpNotEquals:
+        return functor(std::not_equal_to<T>{});
+      case ScanType::OpLessThan:
+        return functor(std::less<T>{});
+      case ScanType::OpLessThanEquals:
+        return functor(std::less_equal<T>{});
+      case ScanType::OpGreaterThan:
+        return functor(std::greater<T>{});
+      case ScanType::OpGreaterThanEquals:
+        return functor(std::greater_equal<T>{});
+    }
+    Fail("Unknown scan type");
+  }
+
+  // Translates the search value into a bound in the sorted dictionary once, so that only the value ids of the rows are
+  // compared, e.g., `value < search_value` becomes `value_id < lower_bound`. Segments in which the bound shows that
+  // all or no rows match are not scanned at all.
+  void _scan_dictionary_segment(const DictionarySegment<T>& segment, std::vector<ChunkOffset>& matches) const {
+    const auto dictionary_size = static_cast<uint32_t>(segment.unique_values_count());
+    const auto to_bound = [&](const ValueID value_id) {
+      return value_id == INVALID_VALUE_ID ? dictionary_size : static_cast<uint32_t>(value_id);
+    };
+    const auto lower_bound = to_bound(segment.lower_bound(_search_value));
+    const auto upper_bound = to_bound(segment.upper_bound(_search_value));
+
+    auto value_id_scan_type = _scan_type;
+    auto bound = lower_bound;
+    auto all_match = false;
+    auto none_match = false;
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        none_match = lower_bound == upper_bound;
+        break;
+      case ScanType::OpNotEquals:
+        all_match = lower_bound == upper_bound;
+        break;
+      case ScanType::OpLessThan:
+        none_match = lower_bound == 0;
+        all_match = lower_bound == dictionary_size;
+        break;
+      case ScanType::OpLessThanEquals:
+        value_id_scan_type = ScanType::OpLessThan;
+        bound = upper_bound;
+        none_match = upper_bound == 0;
+        all_match = upper_bound == dictionary_size;
+        break;
+      case ScanType::OpGreaterThan:
+        value_id_scan_type = ScanType::OpGreaterThanEquals;
+        bound = upper_bound;
+        none_match = upper_bound == dictionary_size;
+        all_match = upper_bound == 0;
+        break;
+      case ScanType::OpGreaterThanEquals:
+        none_match = lower_bound == dictionary_size;
+        all_match = lower_bound == 0;
+        break;
+    }
+
+    const auto size = static_cast<ChunkOffset>(segment.size());
+    if (none_match) return;
+    if (all_match) {
+      const auto first_match = matches.size();
+      matches.resize(first_match + size);
+      std::iota(matches.begin() + first_match, matches.end(), ChunkOffset{0});
+      return;
+    }
+
+    // bound is smaller than the dictionary size here, so it fits into the value id type of the attribute vector
+    const auto attribute_vector = segment.attribute_vector().get();
+    auto scanned = false;
+    const auto scan_fixed_size_value_ids = [&](const auto* fixed_size_attribute_vector) {
+      if (!fixed_size_attribute_vector) return;
+      const auto& value_ids = fixed_size_attribute_vector->values();
+      using ValueIDType = typename std::decay_t<decltype(value_ids)>::value_type;
+      scan_values(value_ids.data(), value_ids.size(), value_id_scan_type, static_cast<ValueIDType>(bound), matches);
+      scanned = true;
+    };
+    scan_fixed_size_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(attribute_vector));
+    scan_fixed_size_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(attribute_vector));
+    scan_fixed_size_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(attribute_vector));
+    if (scanned) return;
+
+    // other attribute vectors, e.g., bit-packed ones, are decoded block by block. ValueID only wraps a uint32_t.
+    static_assert(sizeof(ValueID) == sizeof(uint32_t), "ValueIDs are scanned as uint32_t");
+    auto value_ids = std::vector<ValueID>{};
+    for (auto begin = ChunkOffset{0}; begin < size; begin += DECODE_BLOCK_SIZE) {
+      const auto end = std::min(size, begin + DECODE_BLOCK_SIZE);
+      attribute_vector->decode(begin, end, value_ids);
+      const auto first_match = matches.size();
+      scan_values(reinterpret_cast<const uint32_t*>(value_ids.data()), value_ids.size(), value_id_scan_type, bound,
+                  matches);
+      for (auto match = matches.begin() + first_match; match != matches.end(); ++match) *match += begin;
+    }
+  }
+
+  // Scans each block in offset space: `value < search_value` becomes `offset < search_value - block_minimum`, so that
+  // the packed offsets are compared without adding the minimum back. The values of a block lie in
+  // [minimum, minimum + 2^bit_width - 1]. If the search value lies outside of that range, or the block is constant,
+  // all rows of the block compare like its minimum, and the block is matched or skipped as a whole.
+  void _scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment,
+                                        std::vector<ChunkOffset>& matches) const {
+    using Offset = typename FrameOfReferenceSegment<T>::Offset;
+    constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+    const auto size = static_cast<ChunkOffset>(segment.size());
+
+    auto offsets = std::vector<Offset>{};
+    for (auto block_index = size_t{0}; block_index < segment.block_count(); ++block_index) {
+      const auto block_begin = static_cast<ChunkOffset>(block_index * BLOCK_SIZE);
+      const auto block_end = std::min(size, static_cast<ChunkOffset>(block_begin + BLOCK_SIZE));
+      const auto minimum = segment.block_minimum(block_index);
+      const auto max_offset = static_cast<Offset>(packed_bit_mask(segment.block_bit_width(block_index)));
+
+      // the difference wraps around if the search value is below the block, in which case it is not used
+      const auto below_block = _search_value < minimum;
+      const auto search_offset = static_cast<Offset>(static_cast<Offset>(_search_value) - static_cast<Offset>(minimum));
+      if (below_block || search_offset > max_offset || max_offset == 0) {
+        auto block_matches = false;
+        _resolve_comparator([&](const auto& comparator) { block_matches = comparator(minimum, _search_value); });
+        if (!block_matches) continue;
+        const auto first_match = matches.size();
+        matches.resize(first_match + block_end - block_begin);
+        std::iota(matches.begin() + first_match, matches.end(), block_begin);
+        continue;
+      }
+
+      segment.decode_offsets(block_index, offsets);
+      const auto first_match = matches.size();
+      scan_values(offsets.data(), offsets.size(), _scan_type, search_offset, matches);
+      for (auto match = matches.begin() + first_match; match != matches.end(); ++match) *match += block_begin;
+    }
+  }
+
+  const ScanType _scan_type;
+  const T _search_value;
+};
+
+// Appends the sorted offsets of the rows of a chunk that satisfy a scan's predicate to matches
+using ChunkScan = std::function<void(const Chunk& chunk, std::vector<ChunkOffset>& matches)>;
+
+// Runs scan_chunk on every non-empty chunk of the input table and returns a table of ReferenceSegments to the matches.
+// Tables with enough rows are scanned by multiple tasks on the WorkerPool, which each take the next chunk that has not
+// been scanned yet. The output chunks are in the order of the input chunks either way.
+std::shared_ptr<const Table> scan_table(const std::shared_ptr<const Table>& input_table, const ChunkScan& scan_chunk,
+                                        const ScanParallelism& parallelism = {});
+
+// Creates the output chunk of a scan for the matching rows of an input chunk, given as sorted offsets. Columns that are
+// already ReferenceSegments are resolved to the table they reference. Columns that share a position list in the input
+// also share it in the output. Matches in a single chunk are stored as a compressed position list where that is
+// smaller.
+Chunk make_reference_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                           const Chunk& input_chunk, const std::vector<ChunkOffset>& matches);
+
+// returns the positions of the input position list at the indices in matches, which are sorted
+std::shared_ptr<const AbstractPosList> resolve_pos_list(const AbstractPosList& input_pos_list,
+                                                        const std::vector<ChunkOffset>& matches);
+
+}  // namespace opossum
@@ -0,0 +1,571 @@
+#include "table_scan_kernels.hpp"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto BLOCK_SIZE = size_t{64};
+
+template <ScanType scan_type, typename T>
+bool compare(const T& lhs, const T& rhs) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return lhs == rhs;
+    case ScanType::OpNotEquals:
+      return lhs != rhs;
+    case ScanType::OpLessThan:
+      return lhs < rhs;
+    case ScanType::OpLessThanEquals:
+      return lhs <= rhs;
+    case ScanType::OpGreaterThan:
+      return lhs > rhs;
+    case ScanType::OpGreaterThanEquals:
+      return lhs >= rhs;
+  }
+  return false;
+}
+
+// converts the bitmask of a block into the offsets of its matches
+inline void append_matches(uint64_t mask, const size_t block_begin, std::vector<ChunkOffset>& matches) {
+  while (mask != 0) {
+    matches.push_back(static_cast<ChunkOffset>(block_begin + __builtin_ctzll(mask)));
+    mask &= mask - 1;
+  }
+}
+
+// compares up to BLOCK_SIZE values, also used for the last, incomplete block of the vectorized kernels
+template <ScanType scan_type, typename T>
+uint64_t block_mask_scalar(const T* values, const T search_value, const size_t count) {
+  auto mask = uint64_t{0};
+  for (auto index = size_t{0}; index < count; ++index) {
+    mask |= uint64_t{compare<scan_type>(values[index], search_value)} << index;
+  }
+  return mask;
+}
+
+template <ScanType scan_type, typename T>
+void scan_scalar(const T* values, const size_t size, const T search_value, std::vector<ChunkOffset>& matches) {
+  for (auto begin = size_t{0}; begin < size; begin += BLOCK_SIZE) {
+    const auto count = std::min(BLOCK_SIZE, size - begin);
+    append_matches(block_mask_scalar<scan_type>(values + begin, search_value, count), begin, matches);
+  }
+}
+
+template <ScanType scan_type, typename T>
+uint64_t block_mask_pairs_scalar(const T* left_values, const T* right_values, const size_t count) {
+  auto mask = uint64_t{0};
+  for (auto index = size_t{0}; index < count; ++index) {
+    mask |= uint64_t{compare<scan_type>(left_values[index], right_values[index])} << index;
+  }
+  return mask;
+}
+
+template <ScanType scan_type, typename T>
+void scan_pairs_scalar(const T* left_values, const T* right_values, const size_t size,
+                       std::vector<ChunkOffset>& matches) {
+  for (auto begin = size_t{0}; begin < size; begin += BLOCK_SIZE) {
+    const auto count = std::min(BLOCK_SIZE, size - begin);
+    const auto mask = block_mask_pairs_scalar<scan_type>(left_values + begin, right_values + begin, count);
+    append_matches(mask, begin, matches);
+  }
+}
+
+// checks up to BLOCK_SIZE values against all values of an IN list
+template <typename T>
+uint64_t block_mask_in_scalar(const T* values, const std::vector<T>& search_values, const size_t count) {
+  auto mask = uint64_t{0};
+  for (auto index = size_t{0}; index < count; ++index) {
+    const auto found = std::find(search_values.cbegin(), search_values.cend(), values[index]) != search_values.cend();
+    mask |= uint64_t{found} << index;
+  }
+  return mask;
+}
+
+template <typename T>
+void scan_in_scalar(const T* values, const size_t size, const std::vector<T>& search_values,
+                    std::vector<ChunkOffset>& matches) {
+  for (auto begin = size_t{0}; begin < size; begin += BLOCK_SIZE) {
+    const auto count = std::min(BLOCK_SIZE, size - begin);
+    append_matches(block_mask_in_scalar(values + begin, search_values, count), begin, matches);
+  }
+}
+
+#if defined(__x86_64__)
+
+// AVX2 has no integer less-than, so integers are compared with equality or greater-than, with swapped operands
+// and/or an inverted result
+template <ScanType scan_type>
+constexpr bool uses_equality = scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals;
+template <ScanType scan_type>
+constexpr bool swaps_operands = scan_type == ScanType::OpLessThan || scan_type == ScanType::OpGreaterThanEquals;
+template <ScanType scan_type>
+constexpr bool inverts_result = scan_type == ScanType::OpNotEquals || scan_type == ScanType::OpLessThanEquals ||
+                                scan_type == ScanType::OpGreaterThanEquals;
+
+// floating point predicates are ordered (false for NaN), except for not-equals, like the C++ operators
+constexpr int float_predicate(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _CMP_EQ_OQ;
+    case ScanType::OpNotEquals:
+      return _CMP_NEQ_UQ;
+    case ScanType::OpLessThan:
+      return _CMP_LT_OQ;
+    case ScanType::OpLessThanEquals:
+      return _CMP_LE_OQ;
+    case ScanType::OpGreaterThan:
+      return _CMP_GT_OQ;
+    case ScanType::OpGreaterThanEquals:
+      return _CMP_GE_OQ;
+  }
+  return _CMP_FALSE_OQ;
+}
+
+constexpr int int_predicate(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _MM_CMPINT_EQ;
+    case ScanType::OpNotEquals:
+      return _MM_CMPINT_NE;
+    case ScanType::OpLessThan:
+      return _MM_CMPINT_LT;
+    case ScanType::OpLessThanEquals:
+      return _MM_CMPINT_LE;
+    case ScanType::OpGreaterThan:
+      return _MM_CMPINT_GT;
+    case ScanType::OpGreaterThanEquals:
+      return _MM_CMPINT_GE;
+  }
+  return _MM_CMPINT_UNUSED;  // always false
+}
+
+// the intrinsics require the predicates to be immediates, also in unoptimized builds
+template <ScanType scan_type>
+constexpr int float_predicate_v = float_predicate(scan_type);
+template <ScanType scan_type>
+constexpr int int_predicate_v = int_predicate(scan_type);
+
+// Each compare_* function compares one register of values and returns one bit per value
+
+template <typename T>
+__attribute__((target("avx2"))) __m256i equal_avx2(const __m256i lhs, const __m256i rhs) {
+  if constexpr (sizeof(T) == 1) return _mm256_cmpeq_epi8(lhs, rhs);
+  if constexpr (sizeof(T) == 2) return _mm256_cmpeq_epi16(lhs, rhs);
+  if constexpr (sizeof(T) == 4) return _mm256_cmpeq_epi32(lhs, rhs);
+  if constexpr (sizeof(T) == 8) return _mm256_cmpeq_epi64(lhs, rhs);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) __m256i greater_than_avx2(const __m256i lhs, const __m256i rhs) {
+  if constexpr (sizeof(T) == 1) return _mm256_cmpgt_epi8(lhs, rhs);
+  if constexpr (sizeof(T) == 2) return _mm256_cmpgt_epi16(lhs, rhs);
+  if constexpr (sizeof(T) == 4) return _mm256_cmpgt_epi32(lhs, rhs);
+  if constexpr (sizeof(T) == 8) return _mm256_cmpgt_epi64(lhs, rhs);
+}
+
+// AVX2 only compares signed integers, unsigned integers are compared with their sign bits flipped
+template <typename T>
+__attribute__((target("avx2"))) __m256i flip_sign_bits_avx2(const __m256i values) {
+  if constexpr (std::is_unsigned_v<T>) {
+    constexpr auto sign_bit = std::numeric_limits<std::make_signed_t<T>>::min();
+    if constexpr (sizeof(T) == 1) return _mm256_xor_si256(values, _mm256_set1_epi8(sign_bit));
+    if constexpr (sizeof(T) == 2) return _mm256_xor_si256(values, _mm256_set1_epi16(sign_bit));
+    if constexpr (sizeof(T) == 4) return _mm256_xor_si256(values, _mm256_set1_epi32(sign_bit));
+    if constexpr (sizeof(T) == 8) return _mm256_xor_si256(values, _mm256_set1_epi64x(sign_bit));
+  } else {
+    return values;
+  }
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx2"))) uint32_t compare_avx2(const T* values, const __m256i search_value) {
+  const auto loaded = flip_sign_bits_avx2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)));
+  const auto lhs = swaps_operands<scan_type> ? search_value : loaded;
+  const auto rhs = swaps_operands<scan_type> ? loaded : search_value;
+  auto comparison = uses_equality<scan_type> ? equal_avx2<T>(lhs, rhs) : greater_than_avx2<T>(lhs, rhs);
+  if constexpr (inverts_result<scan_type>) comparison = _mm256_xor_si256(comparison, _mm256_set1_epi64x(-1));
+
+  if constexpr (sizeof(T) == 1) return static_cast<uint32_t>(_mm256_movemask_epi8(comparison));
+  if constexpr (sizeof(T) == 2) {
+    // narrow the 16 bit lanes to bytes, packs_epi16 interleaves the 128 bit halves of its inputs
+    const auto packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(comparison, _mm256_setzero_si256()), 0b11011000);
+    return static_cast<uint32_t>(_mm256_movemask_epi8(packed)) & 0xFFFFu;
+  }
+  if constexpr (sizeof(T) == 4) return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(comparison)));
+  if constexpr (sizeof(T) == 8) return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(comparison)));
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx2"))) uint32_t compare_avx2(const float* values, const __m256 search_value) {
+  const auto comparison = _mm256_cmp_ps(_mm256_loadu_ps(values), search_value, float_predicate_v<scan_type>);
+  return static_cast<uint32_t>(_mm256_movemask_ps(comparison));
+}
+
+template <ScanType scan_type>
+__attribute__((target("avx2"))) uint32_t compare_avx2(const double* values, const __m256d search_value) {
+  const auto comparison = _mm256_cmp_pd(_mm256_loadu_pd(values), search_value, float_predicate_v<scan_type>);
+  return static_cast<uint32_t>(_mm256_movemask_pd(comparison));
+}
+
+template <typename T>
+__attribute__((target("avx2"))) auto broadcast_avx2(const T value) {
+  if constexpr (std::is_same_v<T, float>) return _mm256_set1_ps(value);
+  if constexpr (std::is_same_v<T, double>) return _mm256_set1_pd(value);
+  if constexpr (std::is_integral_v<T> && sizeof(T) == 1) return flip_sign_bits_avx2<T>(_mm256_set1_epi8(value));
+  if constexpr (std::is_integral_v<T> && sizeof(T) == 2) return flip_sign_bits_avx2<T>(_mm256_set1_epi16(value));
+  if constexpr (std::is_integral_v<T> && sizeof(T) == 4) return flip_sign_bits_avx2<T>(_mm256_set1_epi32(value));
+  if constexpr (std::is_integral_v<T> && sizeof(T) == 8) return flip_sign_bits_avx2<T>(_mm256_set1_epi64x(value));
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx2"))) void scan_avx2(const T* values, const size_t size, const T search_value,
+                                               std::vector<ChunkOffset>& matches) {
+  constexpr auto values_per_register = 32 / sizeof(T);
+  const auto broadcast_search_value = broadcast_avx2(search_value);
+
+  auto begin = size_t{0};
+  for (; begin + BLOCK_SIZE <= size; begin += BLOCK_SIZE) {
+    auto mask = uint64_t{0};
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += values_per_register) {
+      mask |= uint64_t{compare_avx2<scan_type>(values + begin + index, broadcast_search_value)} << index;
+    }
+    append_matches(mask, begin, matches);
+  }
+  append_matches(block_mask_scalar<scan_type>(values + begin, search_value, size - begin), begin, matches);
+}
+
+// loads a register of values in the representation that compare_avx2 expects for its second operand
+template <typename T>
+__attribute__((target("avx2"))) auto load_avx2(const T* values) {
+  if constexpr (std::is_same_v<T, float>) return _mm256_loadu_ps(values);
+  if constexpr (std::is_same_v<T, double>) return _mm256_loadu_pd(values);
+  if constexpr (std::is_integral_v<T>) {
+    return flip_sign_bits_avx2<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)));
+  }
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx2"))) void scan_pairs_avx2(const T* left_values, const T* right_values, const size_t size,
+                                                     std::vector<ChunkOffset>& matches) {
+  constexpr auto values_per_register = 32 / sizeof(T);
+
+  auto begin = size_t{0};
+  for (; begin + BLOCK_SIZE <= size; begin += BLOCK_SIZE) {
+    auto mask = uint64_t{0};
+    for (auto index = begin; index < begin + BLOCK_SIZE; index += values_per_register) {
+      const auto register_mask = compare_avx2<scan_type>(left_values + index, load_avx2(right_values + index));
+      mask |= uint64_t{register_mask} << (index - begin);
+    }
+    append_matches(mask, begin, matches);
+  }
+  append_matches(block_mask_pairs_scalar<scan_type>(left_values + begin, right_values + begin, size - begin), begin,
+                 matches);
+}
+
+// each block is compared with one search value after the other, the masks of all of them are combined
+template <typename T>
+__attribute__((target("avx2"))) void scan_in_avx2(const T* values, const size_t size,
+                                                  const std::vector<T>& search_values,
+                                                  std::vector<ChunkOffset>& matches) {
+  constexpr auto values_per_register = 32 / sizeof(T);
+
+  auto begin = size_t{0};
+  for (; begin + BLOCK_SIZE <= size; begin += BLOCK_SIZE) {
+    auto mask = uint64_t{0};
+    for (const auto& search_value : search_values) {
+      const auto broadcast_search_value = broadcast_avx2(search_value);
+      for (auto index = size_t{0}; index < BLOCK_SIZE; index += values_per_register) {
+        mask |= uint64_t{compare_avx2<ScanType::OpEquals>(values + begin + index, broadcast_search_value)} << index;
+      }
+    }
+    append_matches(mask, begin, matches);
+  }
+  append_matches(block_mask_in_scalar(values + begin, search_values, size - begin), begin, matches);
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx512f,avx512bw"))) uint64_t compare_avx512(const T* values, const T search_value) {
+  constexpr auto predicate = std::is_floating_point_v<T> ? float_predicate_v<scan_type> : int_predicate_v<scan_type>;
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm512_cmp_ps_mask(_mm512_loadu_ps(values), _mm512_set1_ps(search_value), predicate);
+  }
+  if constexpr (std::is_same_v<T, double>) {
+    return _mm512_cmp_pd_mask(_mm512_loadu_pd(values), _mm512_set1_pd(search_value), predicate);
+  }
+  if constexpr (std::is_integral_v<T>) {
+    const auto loaded = _mm512_loadu_si512(values);
+    if constexpr (std::is_same_v<T, int32_t>) {
+      return _mm512_cmp_epi32_mask(loaded, _mm512_set1_epi32(search_value), predicate);
+    }
+    if constexpr (std::is_same_v<T, int64_t>) {
+      return _mm512_cmp_epi64_mask(loaded, _mm512_set1_epi64(search_value), predicate);
+    }
+    if constexpr (std::is_same_v<T, uint8_t>) {
+      return _mm512_cmp_epu8_mask(loaded, _mm512_set1_epi8(search_value), predicate);
+    }
+    if constexpr (std::is_same_v<T, uint16_t>) {
+      return _mm512_cmp_epu16_mask(loaded, _mm512_set1_epi16(search_value), predicate);
+    }
+    if constexpr (std::is_same_v<T, uint32_t>) {
+      return _mm512_cmp_epu32_mask(loaded, _mm512_set1_epi32(search_value), predicate);
+    }
+    if constexpr (std::is_same_v<T, uint64_t>) {
+      return _mm512_cmp_epu64_mask(loaded, _mm512_set1_epi64(search_value), predicate);
+    }
+  }
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx512f,avx512bw"))) void scan_avx512(const T* values, const size_t size, const T search_value,
+                                                             std::vector<ChunkOffset>& matches) {
+  constexpr auto values_per_register = 64 / sizeof(T);
+
+  auto begin = size_t{0};
+  for (; begin + BLOCK_SIZE <= size; begin += BLOCK_SIZE) {
+    auto mask = uint64_t{0};
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += values_per_register) {
+      mask |= compare_avx512<scan_type>(values + begin + index, search_value) << index;
+    }
+    append_matches(mask, begin, matches);
+  }
+  append_matches(block_mask_scalar<scan_type>(values + begin, search_value, size - begin), begin, matches);
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx512f,avx512bw"))) uint64_t compare_pairs_avx512(const T* left_values,
+                                                                          const T* right_values) {
+  constexpr auto predicate = std::is_floating_point_v<T> ? float_predicate_v<scan_type> : int_predicate_v<scan_type>;
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm512_cmp_ps_mask(_mm512_loadu_ps(left_values), _mm512_loadu_ps(right_values), predicate);
+  }
+  if constexpr (std::is_same_v<T, double>) {
+    return _mm512_cmp_pd_mask(_mm512_loadu_pd(left_values), _mm512_loadu_pd(right_values), predicate);
+  }
+  if constexpr (std::is_same_v<T, int32_t>) {
+    return _mm512_cmp_epi32_mask(_mm512_loadu_si512(left_values), _mm512_loadu_si512(right_values), predicate);
+  }
+  if constexpr (std::is_same_v<T, int64_t>) {
+    return _mm512_cmp_epi64_mask(_mm512_loadu_si512(left_values), _mm512_loadu_si512(right_values), predicate);
+  }
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx512f,avx512bw"))) void scan_pairs_avx512(const T* left_values, const T* right_values,
+                                                                   const size_t size,
+                                                                   std::vector<ChunkOffset>& matches) {
+  constexpr auto values_per_register = 64 / sizeof(T);
+
+  auto begin = size_t{0};
+  for (; begin + BLOCK_SIZE <= size; begin += BLOCK_SIZE) {
+    auto mask = uint64_t{0};
+    for (auto index = begin; index < begin + BLOCK_SIZE; index += values_per_register) {
+      mask |= compare_pairs_avx512<scan_type>(left_values + index, right_values + index) << (index - begin);
+    }
+    append_matches(mask, begin, matches);
+  }
+  append_matches(block_mask_pairs_scalar<scan_type>(left_values + begin, right_values + begin, size - begin), begin,
+                 matches);
+}
+
+template <typename T>
+__attribute__((target("avx512f,avx512bw"))) void scan_in_avx512(const T* values, const size_t size,
+                                                                const std::vector<T>& search_values,
+                                                                std::vector<ChunkOffset>& matches) {
+  constexpr auto values_per_register = 64 / sizeof(T);
+
+  auto begin = size_t{0};
+  for (; begin + BLOCK_SIZE <= size; begin += BLOCK_SIZE) {
+    auto mask = uint64_t{0};
+    for (const auto& search_value : search_values) {
+      for (auto index = size_t{0}; index < BLOCK_SIZE; index += values_per_register) {
+        mask |= compare_avx512<ScanType::OpEquals>(values + begin + index, search_value) << index;
+      }
+    }
+    append_matches(mask, begin, matches);
+  }
+  append_matches(block_mask_in_scalar(values + begin, search_values, size - begin), begin, matches);
+}
+
+#endif
+
+template <ScanType scan_type, typename T>
+void scan_with_kernel(const T* values, const size_t size, const T search_value, std::vector<ChunkOffset>& matches,
+                      const ScanKernelType kernel_type) {
+  switch (kernel_type) {
+    case ScanKernelType::Scalar:
+      return scan_scalar<scan_type>(values, size, search_value, matches);
+#if defined(__x86_64__)
+    case ScanKernelType::AVX2:
+      return scan_avx2<scan_type>(values, size, search_value, matches);
+    case ScanKernelType::AVX512:
+      return scan_avx512<scan_type>(values, size, search_value, matches);
+#else
+    default:
+      break;
+#endif
+  }
+  Fail("Unknown scan kernel type");
+}
+
+template <ScanType scan_type, typename T>
+void scan_pairs_with_kernel(const T* left_values, const T* right_values, const size_t size,
+                            std::vector<ChunkOffset>& matches, const ScanKernelType kernel_type) {
+  switch (kernel_type) {
+    case ScanKernelType::Scalar:
+      return scan_pairs_scalar<scan_type>(left_values, right_values, size, matches);
+#if defined(__x86_64__)
+    case ScanKernelType::AVX2:
+      return scan_pairs_avx2<scan_type>(left_values, right_values, size, matches);
+    case ScanKernelType::AVX512:
+      return scan_pairs_avx512<scan_type>(left_values, right_values, size, matches);
+#else
+    default:
+      break;
+#endif
+  }
+  Fail("Unknown scan kernel type");
+}
+
+}  // namespace
+
+bool is_scan_kernel_supported(const ScanKernelType kernel_type) {
+  switch (kernel_type) {
+    case ScanKernelType::Scalar:
+      return true;
+#if defined(__x86_64__)
+    case ScanKernelType::AVX2:
+      return __builtin_cpu_supports("avx2");
+    case ScanKernelType::AVX512:
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#else
+    default:
+      return false;
+#endif
+  }
+  return false;
+}
+
+ScanKernelType fastest_scan_kernel_type() {
+  static const auto fastest_kernel_type = []() {
+    for (const auto kernel_type : {ScanKernelType::AVX512, ScanKernelType::AVX2}) {
+      if (is_scan_kernel_supported(kernel_type)) return kernel_type;
+    }
+    return ScanKernelType::Scalar;
+  }();
+  return fastest_kernel_type;
+}
+
+template <typename T>
+void scan_values(const T* values, const size_t size, const ScanType scan_type, const T search_value,
+                 std::vector<ChunkOffset>& matches, const ScanKernelType kernel_type) {
+  DebugAssert(is_scan_kernel_supported(kernel_type), "Scan kernel is not supported by this CPU");
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return scan_with_kernel<ScanType::OpEquals>(values, size, search_value, matches, kernel_type);
+    case ScanType::OpNotEquals:
+      return scan_with_kernel<ScanType::OpNotEquals>(values, size, search_value, matches, kernel_type);
+    case ScanType::OpLessThan:
+      return scan_with_kernel<ScanType::OpLessThan>(values, size, search_value, matches, kernel_type);
+    case ScanType::OpLessThanEquals:
+      return scan_with_kernel<ScanType::OpLessThanEquals>(values, size, search_value, matches, kernel_type);
+    case ScanType::OpGreaterThan:
+      return scan_with_kernel<ScanType::OpGreaterThan>(values, size, search_value, matches, kernel_type);
+    case ScanType::OpGreaterThanEquals:
+      return scan_with_kernel<ScanType::OpGreaterThanEquals>(values, size, search_value, matches, kernel_type);
+  }
+  Fail("Unknown scan type");
+}
+
+template <typename T>
+void scan_values_in(const T* values, const size_t size, const std::vector<T>& search_values,
+                    std::vector<ChunkOffset>& matches, const ScanKernelType kernel_type) {
+  DebugAssert(is_scan_kernel_supported(kernel_type), "Scan kernel is not supported by this CPU");
+
+  switch (kernel_type) {
+    case ScanKernelType::Scalar:
+      return scan_in_scalar(values, size, search_values, matches);
+#if defined(__x86_64__)
+    case ScanKernelType::AVX2:
+      return scan_in_avx2(values, size, search_values, matches);
+    case ScanKernelType::AVX512:
+      return scan_in_avx512(values, size, search_values, matches);
+#else
+    default:
+      break;
+#endif
+  }
+  Fail("Unknown scan kernel type");
+}
+
+template <typename T>
+void scan_value_pairs(const T* left_values, const T* right_values, const size_t size, const ScanType scan_type,
+                      std::vector<ChunkOffset>& matches, const ScanKernelType kernel_type) {
+  DebugAssert(is_scan_kernel_supported(kernel_type), "Scan kernel is not supported by this CPU");
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return scan_pairs_with_kernel<ScanType::OpEquals>(left_values, right_values, size, matches, kernel_type);
+    case ScanType::OpNotEquals:
+      return scan_pairs_with_kernel<ScanType::OpNotEquals>(left_values, right_values, size, matches, kernel_type);
+    case ScanType::OpLessThan:
+      return scan_pairs_with_kernel<ScanType::OpLessThan>(left_values, right_values, size, matches, kernel_type);
+    case ScanType::OpLessThanEquals:
+      return scan_pairs_with_kernel<ScanType::OpLessThanEquals>(left_values, right_values, size, matches, kernel_type);
+    case ScanType::OpGreaterThan:
+      return scan_pairs_with_kernel<ScanType::OpGreaterThan>(left_values, right_values, size, matches, kernel_type);
+    case ScanType::OpGreaterThanEquals:
+      return scan_pairs_with_kernel<ScanType::OpGreaterThanEquals>(left_values, right_values, size, matches,
+                                                                   kernel_type);
+  }
+  Fail("Unknown scan type");
+}
+
+template void scan_values<uint8_t>(const uint8_t*, const size_t, const ScanType, const uint8_t,
+                                   std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_values<uint16_t>(const uint16_t*, const size_t, const ScanType, const uint16_t,
+                                    std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_values<uint32_t>(const uint32_t*, const size_t, const ScanType, const uint32_t,
+                                    std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_values<uint64_t>(const uint64_t*, const size_t, const ScanType, const uint64_t,
+                                    std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_values<int32_t>(const int32_t*, const size_t, const ScanType, const int32_t,
+                                   std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_values<int64_t>(const int64_t*, const size_t, const ScanType, const int64_t,
+                                   std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_values<float>(const float*, const size_t, const ScanType, const float, std::vector<ChunkOffset>&,
+                                 const ScanKernelType);
+template void scan_values<double>(const double*, const size_t, const ScanType, const double,
+                                  std::vector<ChunkOffset>&, const ScanKernelType);
+
+template void scan_values_in<int32_t>(const int32_t*, const size_t, const std::vector<int32_t>&,
+                                      std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_values_in<int64_t>(const int64_t*, const size_t, const std::vector<int64_t>&,
+                                      std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_values_in<float>(const float*, const size_t, const std::vector<float>&, std::vector<ChunkOffset>&,
+                                    const ScanKernelType);
+template void scan_values_in<double>(const double*, const size_t, const std::vector<double>&,
+                                     std::vector<ChunkOffset>&, const ScanKernelType);
+
+template void scan_value_pairs<int32_t>(const int32_t*, const int32_t*, const size_t, const ScanType,
+                                        std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_value_pairs<int64_t>(const int64_t*, const int64_t*, const size_t, const ScanType,
+                                        std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_value_pairs<float>(const float*, const float*, const size_t, const ScanType,
+                                      std::vector<ChunkOffset>&, const ScanKernelType);
+template void scan_value_pairs<double>(const double*, const double*, const size_t, const ScanType,
+                                       std::vector<ChunkOffset>&, const ScanKernelType);
+
+}  // namespace opossum
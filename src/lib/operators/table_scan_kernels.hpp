@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Instruction sets the value scan kernels are implemented for. AVX512 requires AVX-512F and AVX-512BW.
+enum class ScanKernelType { Scalar, AVX2, AVX512 };
+
+// returns whether the CPU the process runs on supports the kernel type
+bool is_scan_kernel_supported(const ScanKernelType kernel_type);
+
+// returns the fastest kernel type that the CPU supports, which is detected once
+ScanKernelType fastest_scan_kernel_type();
+
+// Appends the indices of all values for which `value <scan_type> search_value` holds to matches, in ascending order.
+// The values are compared in blocks of 64, which each result in a bitmask of matches that is then converted into
+// indices. T must be int32_t, int64_t, float or double, the value id type of an attribute vector, i.e., uint8_t,
+// uint16_t or uint32_t, or the offset type of a FrameOfReferenceSegment, i.e., uint32_t or uint64_t.
+template <typename T>
+void scan_values(const T* values, const size_t size, const ScanType scan_type, const T search_value,
+                 std::vector<ChunkOffset>& matches, const ScanKernelType kernel_type = fastest_scan_kernel_type());
+
+// Appends the indices of all values that are equal to any of the search values to matches, in ascending order. Each
+// block of values is compared with every search value, so this is meant for short IN lists. T must be int32_t,
+// int64_t, float or double.
+template <typename T>
+void scan_values_in(const T* values, const size_t size, const std::vector<T>& search_values,
+                    std::vector<ChunkOffset>& matches, const ScanKernelType kernel_type = fastest_scan_kernel_type());
+
+// Appends the indices i for which `left_values[i] <scan_type> right_values[i]` holds to matches, in ascending order.
+// T must be int32_t, int64_t, float or double.
+template <typename T>
+void scan_value_pairs(const T* left_values, const T* right_values, const size_t size, const ScanType scan_type,
+                      std::vector<ChunkOffset>& matches, const ScanKernelType kernel_type = fastest_scan_kernel_type());
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "types.hpp"
 
 namespace opossum {
@@ -27,5 +29,13 @@ class BaseAttributeVector : private Noncopyable {
 
   // returns the width of biggest value id in bytes
   virtual AttributeVectorWidth width() const = 0;
+
+  // returns the calculated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
+
+  // decodes the value ids at the positions [begin, end) into output, which is resized to end - begin.
+  // Operators should prefer this over get() when reading more than a handful of values, as it costs one virtual call
+  // per block instead of one per value and allows the implementations to widen many value ids at once.
+  virtual void decode(const size_t begin, const size_t end, std::vector<ValueID>& output) const = 0;
 };
 }  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Segment filters summarize the values of a segment so that a scan can skip the segment (and thus its chunk) without
+// looking at its values. Filters may produce false positives, but never false negatives.
+class BaseSegmentFilter : private Noncopyable {
+ public:
+  BaseSegmentFilter() = default;
+  virtual ~BaseSegmentFilter() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseSegmentFilter(BaseSegmentFilter&&) = default;
+  BaseSegmentFilter& operator=(BaseSegmentFilter&&) = default;
+
+  // returns true if no value of the segment can satisfy "value <scan_type> search_value"
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // returns the calculated memory usage
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+}  // namespace opossum
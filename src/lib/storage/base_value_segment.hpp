@@ -0,0 +1,32 @@
+#pragma once
+
+#include "base_segment.hpp"
+
+namespace opossum {
+
+// BaseValueSegment is the abstract super class of all ValueSegments. Besides append(), it allows a chunk to fill
+// pre-allocated rows from several threads at once without knowing the data type of the segment.
+class BaseValueSegment : public BaseSegment {
+ public:
+  // allocates space for at least capacity values, must not be called while rows are written concurrently
+  virtual void presize(size_t capacity) = 0;
+
+  // converts a value to the data type of the segment, throws if this is not possible
+  virtual AllTypeVariant convert(const AllTypeVariant& value) const = 0;
+
+  // Moves a value returned by convert() to an allocated row behind the end of the segment, i.e., one that is not yet
+  // visible to readers. Different rows may be written concurrently. As the value has been converted already, this
+  // does not throw, so a row that has been reserved for the value is always filled.
+  virtual void write(const ChunkOffset chunk_offset, AllTypeVariant&& value) = 0;
+
+  // makes the first size rows visible to readers, all of them must have been written before
+  virtual void commit(size_t size) = 0;
+
+  // Bulk versions of append() and write(). They copy count values, starting at first_row, from a ValueSegment of the
+  // same data type without converting them to AllTypeVariant.
+  virtual void append_values(const BaseValueSegment& source, size_t first_row, size_t count) = 0;
+  virtual void write_values(const ChunkOffset chunk_offset, const BaseValueSegment& source, size_t first_row,
+                            size_t count) = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/bit_packing.hpp"
+
+namespace opossum {
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width)
+    : _size(size), _bit_width(bit_width), _mask(packed_bit_mask(bit_width)) {
+  DebugAssert(bit_width <= std::numeric_limits<ValueID::base_type>::digits, "Bit width exceeds the width of ValueID");
+  // A bit width of zero means that all value ids are zero, so there is nothing to store.
+  if (_bit_width > 0) {
+    _words = std::vector<uint64_t>(packed_word_count(size, _bit_width));
+  }
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const std::vector<uint32_t>& value_ids, const uint8_t bit_width)
+    : BitPackedAttributeVector(value_ids.size(), bit_width) {
+  if (_bit_width == 0) return;
+
+  auto bit_position = size_t{0};
+  for (const auto value_id : value_ids) {
+    DebugAssert((value_id & ~_mask) == 0, "ValueID does not fit into the bit width of the attribute vector");
+    write_packed_bits(_words.data(), bit_position, _bit_width, value_id);
+    bit_position += _bit_width;
+  }
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "Position out of range");
+  if (_bit_width == 0) return ValueID{0};
+  return ValueID{static_cast<ValueID::base_type>(read_packed_bits(_words.data(), i * _bit_width, _mask))};
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  DebugAssert(i < _size, "Position out of range");
+  DebugAssert((value_id & ~_mask) == 0, "ValueID does not fit into the bit width of the attribute vector");
+  write_packed_bits(_words.data(), i * _bit_width, _bit_width, value_id);
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return AttributeVectorWidth((_bit_width + 7) / 8); }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const { return _words.size() * sizeof(uint64_t); }
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+void BitPackedAttributeVector::decode(const size_t begin, const size_t end, std::vector<ValueID>& output) const {
+  DebugAssert(begin <= end && end <= _size, "Invalid range");
+  output.resize(end - begin);
+
+  if (_bit_width == 0) {
+    std::fill(output.begin(), output.end(), ValueID{0});
+    return;
+  }
+
+  auto bit_position = begin * _bit_width;
+  for (auto& value_id : output) {
+    value_id = ValueID{static_cast<ValueID::base_type>(read_packed_bits(_words.data(), bit_position, _mask))};
+    bit_position += _bit_width;
+  }
+}
+
+uint8_t BitPackedAttributeVector::required_bit_width(const size_t unique_values_count) {
+  // the largest value id is unique_values_count - 1
+  return unique_values_count <= 1 ? 0 : packed_bit_width(unique_values_count - 1);
+}
+
+}  // namespace opossum
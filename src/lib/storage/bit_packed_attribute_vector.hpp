@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores each value id with exactly as many bits as are needed to represent the largest
+// value id, i.e., ceil(log2(unique_values_count)). The value ids are packed back to back into 64-bit words and may
+// straddle word boundaries. A single trailing padding word allows reading two adjacent words without a branch.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width);
+
+  // packs already computed value ids, which is much faster than calling set() for each of them
+  BitPackedAttributeVector(const std::vector<uint32_t>& value_ids, const uint8_t bit_width);
+
+  // returns the value id at a given position
+  ValueID get(const size_t i) const override;
+
+  // sets the value id at a given position
+  void set(const size_t i, const ValueID value_id) override;
+
+  // returns the number of values
+  size_t size() const override;
+
+  // returns the width of biggest value id in bytes, rounded up
+  AttributeVectorWidth width() const override;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const override;
+
+  // returns the number of bits used per value id
+  uint8_t bit_width() const;
+
+  // decodes the value ids at the positions [begin, end) into output, which is resized to end - begin
+  void decode(const size_t begin, const size_t end, std::vector<ValueID>& output) const override;
+
+  // returns the number of bits needed to distinguish unique_values_count value ids
+  static uint8_t required_bit_width(const size_t unique_values_count);
+
+ protected:
+  size_t _size;
+  uint8_t _bit_width;
+  uint64_t _mask;
+  std::vector<uint64_t> _words;
+};
+
+}  // namespace opossum
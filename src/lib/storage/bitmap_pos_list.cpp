@@ -0,0 +1,101 @@
+#include "bitmap_pos_list.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto BITMAP_CONTAINER_WORDS = size_t{(1u << 16) / 64};
+
+// calls functor(key, begin, end) for the offsets [begin, end) that share the same upper 16 bits
+template <typename Functor>
+void for_each_container(const std::vector<ChunkOffset>& chunk_offsets, const Functor& functor) {
+  auto begin = chunk_offsets.cbegin();
+  while (begin != chunk_offsets.cend()) {
+    const auto key = static_cast<uint16_t>(*begin >> 16);
+    const auto end = std::find_if(begin, chunk_offsets.cend(),
+                                  [&](const ChunkOffset chunk_offset) { return (chunk_offset >> 16) != key; });
+    functor(key, begin, end);
+    begin = end;
+  }
+}
+
+}  // namespace
+
+BitmapPosList::BitmapPosList(const ChunkID chunk_id, const std::vector<ChunkOffset>& chunk_offsets)
+    : _chunk_id(chunk_id), _size(chunk_offsets.size()) {
+  DebugAssert(std::adjacent_find(chunk_offsets.cbegin(), chunk_offsets.cend(), std::greater_equal<ChunkOffset>{}) ==
+                  chunk_offsets.cend(),
+              "Offsets must be sorted and unique");
+
+  for_each_container(chunk_offsets, [&](const uint16_t key, const auto begin, const auto end) {
+    auto& container = _containers.emplace_back();
+    container.key = key;
+    container.first_index = static_cast<size_t>(begin - chunk_offsets.cbegin());
+    if (static_cast<size_t>(end - begin) <= ARRAY_CONTAINER_MAX_SIZE) {
+      container.array.reserve(end - begin);
+      for (auto it = begin; it != end; ++it) container.array.push_back(static_cast<uint16_t>(*it));
+    } else {
+      container.bitmap.resize(BITMAP_CONTAINER_WORDS);
+      for (auto it = begin; it != end; ++it) {
+        const auto low_bits = *it & 0xFFFFu;
+        container.bitmap[low_bits / 64] |= uint64_t{1} << (low_bits % 64);
+      }
+    }
+  });
+  _containers.shrink_to_fit();
+}
+
+size_t BitmapPosList::estimate_memory_usage(const std::vector<ChunkOffset>& chunk_offsets) {
+  auto memory_usage = sizeof(BitmapPosList);
+  for_each_container(chunk_offsets, [&](const uint16_t, const auto begin, const auto end) {
+    const auto count = static_cast<size_t>(end - begin);
+    memory_usage += sizeof(Container) +
+                    (count <= ARRAY_CONTAINER_MAX_SIZE ? count * sizeof(uint16_t) : BITMAP_CONTAINER_WORDS * 8);
+  });
+  return memory_usage;
+}
+
+ChunkID BitmapPosList::chunk_id() const { return _chunk_id; }
+
+size_t BitmapPosList::size() const { return _size; }
+
+RowID BitmapPosList::get(const size_t index) const {
+  DebugAssert(index < _size, "Position out of range");
+
+  const auto container = std::prev(std::upper_bound(
+      _containers.cbegin(), _containers.cend(), index,
+      [](const size_t searched_index, const Container& container) { return searched_index < container.first_index; }));
+  const auto high_bits = ChunkOffset{container->key} << 16;
+  auto rank = index - container->first_index;
+  if (container->bitmap.empty()) return RowID{_chunk_id, high_bits | container->array[rank]};
+
+  // find the word that holds the searched bit, then clear the lower set bits of that word
+  auto word_index = size_t{0};
+  for (;; ++word_index) {
+    const auto bit_count = static_cast<size_t>(__builtin_popcountll(container->bitmap[word_index]));
+    if (rank < bit_count) break;
+    rank -= bit_count;
+  }
+  auto word = container->bitmap[word_index];
+  for (; rank > 0; --rank) word &= word - 1;
+  return RowID{_chunk_id, high_bits | static_cast<ChunkOffset>(word_index * 64 + __builtin_ctzll(word))};
+}
+
+bool BitmapPosList::references_single_chunk() const { return true; }
+
+size_t BitmapPosList::memory_usage() const {
+  auto memory_usage = sizeof(*this) + _containers.capacity() * sizeof(Container);
+  for (const auto& container : _containers) {
+    memory_usage += container.array.capacity() * sizeof(uint16_t) + container.bitmap.capacity() * sizeof(uint64_t);
+  }
+  return memory_usage;
+}
+
+}  // namespace opossum
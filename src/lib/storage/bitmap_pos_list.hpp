@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Sorted positions in a single chunk, stored like a roaring bitmap: the chunk offsets are split into containers of
+// 2^16 offsets by their upper 16 bits. A container stores the lower 16 bits of its offsets as a sorted array while it
+// holds at most ARRAY_CONTAINER_MAX_SIZE of them, i.e., two bytes per position, and as a bitmap of 2^16 bits (8 KB)
+// otherwise. Dense scan results thus take about one bit per row of the chunk instead of eight bytes per match.
+class BitmapPosList final : public AbstractPosList {
+ public:
+  static constexpr auto ARRAY_CONTAINER_MAX_SIZE = size_t{4096};
+
+  // chunk_offsets must be sorted and unique
+  BitmapPosList(const ChunkID chunk_id, const std::vector<ChunkOffset>& chunk_offsets);
+
+  // returns the memory usage of a BitmapPosList of the given sorted and unique offsets without creating it
+  static size_t estimate_memory_usage(const std::vector<ChunkOffset>& chunk_offsets);
+
+  ChunkID chunk_id() const;
+
+  size_t size() const final;
+
+  RowID get(const size_t index) const final;
+
+  bool references_single_chunk() const final;
+
+  size_t memory_usage() const final;
+
+  // calls functor(index, row_id) for every position in ascending order
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    auto index = size_t{0};
+    for (const auto& container : _containers) {
+      const auto high_bits = ChunkOffset{container.key} << 16;
+      if (container.bitmap.empty()) {
+        for (const auto low_bits : container.array) functor(index++, RowID{_chunk_id, high_bits | low_bits});
+        continue;
+      }
+      for (auto word_index = ChunkOffset{0}; word_index < container.bitmap.size(); ++word_index) {
+        auto word = container.bitmap[word_index];
+        while (word != 0) {
+          const auto bit = static_cast<ChunkOffset>(__builtin_ctzll(word));
+          functor(index++, RowID{_chunk_id, high_bits | (word_index * 64 + bit)});
+          word &= word - 1;
+        }
+      }
+    }
+  }
+
+ protected:
+  struct Container {
+    // upper 16 bits of the container's offsets
+    uint16_t key;
+    // index of the container's first position in the list
+    size_t first_index;
+    // either array or bitmap is used
+    std::vector<uint16_t> array;
+    std::vector<uint64_t> bitmap;
+  };
+
+  const ChunkID _chunk_id;
+  size_t _size;
+  std::vector<Container> _containers;
+};
+
+}  // namespace opossum
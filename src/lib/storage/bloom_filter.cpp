@@ -0,0 +1,98 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
+#include "dictionary_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// std::hash is the identity for integers, so the bits are mixed (splitmix64 finalizer) before deriving the positions
+uint64_t mix_hash(uint64_t hash) {
+  hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+  return hash ^ (hash >> 31);
+}
+
+}  // namespace
+
+template <typename T>
+BloomFilter<T>::BloomFilter(const size_t distinct_value_count) {
+  _allocate(distinct_value_count);
+}
+
+template <typename T>
+BloomFilter<T>::BloomFilter(const std::shared_ptr<const BaseSegment>& segment) {
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    _allocate(dictionary_segment->unique_values_count());
+    const auto& dictionary = *dictionary_segment->dictionary();
+    if constexpr (std::is_same_v<T, std::string>) {
+      dictionary.for_each([&](const size_t, const std::string& value) { insert(value); });
+    } else {
+      for (const auto& value : dictionary) insert(value);
+    }
+    return;
+  }
+
+  const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment);
+  Assert(value_segment, "Bloom filters can only be built from value segments or dictionary segments");
+
+  const auto& values = value_segment->values();
+  const auto distinct_values = std::unordered_set<T>(values.cbegin(), values.cend());
+  _allocate(distinct_values.size());
+  for (const auto& value : distinct_values) insert(value);
+}
+
+template <typename T>
+void BloomFilter<T>::insert(const T& value) {
+  const auto hash = mix_hash(std::hash<T>{}(value));
+  const auto hash_1 = hash & 0xFFFFFFFF;
+  const auto hash_2 = (hash >> 32) | 1;
+  for (auto hash_index = size_t{0}; hash_index < HASH_COUNT; ++hash_index) {
+    const auto bit = (hash_1 + hash_index * hash_2) % _bit_count;
+    _words[bit / 64] |= uint64_t{1} << (bit % 64);
+  }
+}
+
+template <typename T>
+bool BloomFilter<T>::may_contain(const T& value) const {
+  const auto hash = mix_hash(std::hash<T>{}(value));
+  const auto hash_1 = hash & 0xFFFFFFFF;
+  const auto hash_2 = (hash >> 32) | 1;
+  for (auto hash_index = size_t{0}; hash_index < HASH_COUNT; ++hash_index) {
+    const auto bit = (hash_1 + hash_index * hash_2) % _bit_count;
+    if (!(_words[bit / 64] & (uint64_t{1} << (bit % 64)))) return false;
+  }
+  return true;
+}
+
+template <typename T>
+bool BloomFilter<T>::can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  if (scan_type != ScanType::OpEquals) return false;
+  return !may_contain(type_cast<T>(search_value));
+}
+
+template <typename T>
+size_t BloomFilter<T>::estimate_memory_usage() const {
+  return _words.size() * sizeof(uint64_t);
+}
+
+template <typename T>
+void BloomFilter<T>::_allocate(const size_t distinct_value_count) {
+  const auto word_count = std::max(size_t{1}, (distinct_value_count * BITS_PER_VALUE + 63) / 64);
+  _words.assign(word_count, 0);
+  _bit_count = word_count * 64;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BloomFilter);
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base_segment_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// A BloomFilter records which values a segment contains with a configurable rate of false positives. Unlike zone maps,
+// it helps equality scans on high-cardinality columns whose values are not clustered (e.g., session ids), where the
+// min/max of every chunk spans the whole domain. Only ScanType::OpEquals can be pruned.
+//
+// The filter uses BITS_PER_VALUE bits per distinct value and HASH_COUNT hash functions derived from one 64-bit hash via
+// double hashing, which gives a false positive rate of about 1%.
+template <typename T>
+class BloomFilter : public BaseSegmentFilter {
+ public:
+  static constexpr auto BITS_PER_VALUE = size_t{10};
+  static constexpr auto HASH_COUNT = size_t{7};
+
+  // creates an empty filter sized for the given number of distinct values
+  explicit BloomFilter(const size_t distinct_value_count);
+
+  // Creates a filter containing all values of a value segment or a dictionary segment. For dictionary segments, the
+  // filter is sized from unique_values_count() and only the dictionary is read.
+  explicit BloomFilter(const std::shared_ptr<const BaseSegment>& segment);
+
+  void insert(const T& value);
+
+  // returns false if the value was definitely not inserted
+  bool may_contain(const T& value) const;
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  void _allocate(const size_t distinct_value_count);
+
+  size_t _bit_count = 0;
+  std::vector<uint64_t> _words;
+};
+
+}  // namespace opossum
@@ -1,30 +1,219 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "base_segment_filter.hpp"
+#include "base_value_segment.hpp"
 #include "chunk.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) { _segments.push_back(segment); }
+void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
+  if (_append_state) {
+    const auto value_segment = std::dynamic_pointer_cast<BaseValueSegment>(segment);
+    Assert(value_segment && value_segment->size() == 0, "Only empty ValueSegments can be added to a pre-sized chunk");
+    value_segment->presize(_append_state->capacity.load());
+  }
+  _segments.push_back(segment);
+  _segment_filters.emplace_back(nullptr);
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert(values.size() == _segments.size(), "Incorrect Data rows vs segment Rows");
-  for (size_t current_segment = 0; current_segment < _segments.size(); current_segment++) {
-    _segments[current_segment]->append(values.at(current_segment));
+  if (_append_state) {
+    Assert(try_append(values), "Chunk is full");
+    return;
+  }
+  Assert(!_is_sealed, "Chunk is sealed");
+  // like in _commit_rows, the first segment grows last, so that size() never reports rows other segments lack
+  for (auto column_id = _segments.size(); column_id > 0; --column_id) {
+    _segments[column_id - 1]->append(values.at(column_id - 1));
+  }
+}
+
+void Chunk::presize(ChunkOffset capacity) {
+  Assert(size() == 0 && !_append_state, "Only empty chunks can be pre-sized");
+  for (const auto& segment : _segments) {
+    const auto value_segment = std::dynamic_pointer_cast<BaseValueSegment>(segment);
+    Assert(value_segment, "Only chunks of ValueSegments can be pre-sized");
+    value_segment->presize(std::min(capacity, INITIAL_PRESIZED_CAPACITY));
+  }
+  _append_state = std::make_unique<AppendState>(std::min(capacity, INITIAL_PRESIZED_CAPACITY), capacity);
+}
+
+std::optional<ChunkOffset> Chunk::try_append(const std::vector<AllTypeVariant>& values) {
+  DebugAssert(values.size() == _segments.size(), "Incorrect Data rows vs segment Rows");
+  if (!_append_state) return std::nullopt;
+
+  // A reserved row has to be committed, or writers of later rows wait for it forever. So everything that can fail
+  // happens before the row is reserved.
+  auto converted_values = std::vector<AllTypeVariant>{};
+  converted_values.reserve(_segments.size());
+  for (auto column_id = size_t{0}; column_id < _segments.size(); ++column_id) {
+    converted_values.emplace_back(static_cast<BaseValueSegment&>(*_segments[column_id]).convert(values[column_id]));
+  }
+
+  const auto range = _reserve_rows(1);
+  if (!range) return std::nullopt;
+  const auto chunk_offset = range->first;
+
+  for (auto column_id = size_t{0}; column_id < _segments.size(); ++column_id) {
+    static_cast<BaseValueSegment&>(*_segments[column_id]).write(chunk_offset, std::move(converted_values[column_id]));
   }
+
+  _commit_rows(chunk_offset, 1);
+  return chunk_offset;
 }
 
+void Chunk::append_segments(const std::vector<std::shared_ptr<const BaseValueSegment>>& segments, size_t first_row,
+                            size_t count) {
+  DebugAssert(segments.size() == _segments.size(), "Incorrect Data rows vs segment Rows");
+  if (_append_state) {
+    const auto range = try_append_segments(segments, first_row, count);
+    Assert(range && range->second == count, "Chunk is full");
+    return;
+  }
+  Assert(!_is_sealed, "Chunk is sealed");
+  for (auto column_id = _segments.size(); column_id > 0; --column_id) {
+    const auto value_segment = std::dynamic_pointer_cast<BaseValueSegment>(_segments[column_id - 1]);
+    Assert(value_segment, "Values can only be appended to ValueSegments");
+    value_segment->append_values(*segments[column_id - 1], first_row, count);
+  }
+}
+
+std::optional<std::pair<ChunkOffset, ChunkOffset>> Chunk::try_append_segments(
+    const std::vector<std::shared_ptr<const BaseValueSegment>>& segments, size_t first_row, size_t count) {
+  DebugAssert(segments.size() == _segments.size(), "Incorrect Data rows vs segment Rows");
+  if (!_append_state || count == 0) return std::nullopt;
+
+  // like in try_append(), the rows are only reserved once they can be written
+  for (auto column_id = size_t{0}; column_id < _segments.size(); ++column_id) {
+    Assert(typeid(*segments[column_id]) == typeid(*_segments[column_id]), "Segment has a different data type");
+    Assert(first_row + count <= segments[column_id]->size(), "Rows out of range");
+  }
+
+  // reserve as many of the rows as are still free
+  const auto range = _reserve_rows(count);
+  if (!range) return std::nullopt;
+  const auto [chunk_offset, reserved_count] = *range;
+
+  for (auto column_id = size_t{0}; column_id < _segments.size(); ++column_id) {
+    static_cast<BaseValueSegment&>(*_segments[column_id])
+        .write_values(chunk_offset, *segments[column_id], first_row, reserved_count);
+  }
+
+  _commit_rows(chunk_offset, reserved_count);
+  return range;
+}
+
+std::optional<std::pair<ChunkOffset, ChunkOffset>> Chunk::_reserve_rows(size_t count) {
+  auto& state = *_append_state;
+  auto chunk_offset = state.reserved_rows.load(std::memory_order_relaxed);
+  while (true) {
+    // rows below the capacity are allocated, acquiring it makes the segments' current buffers visible
+    const auto capacity = state.capacity.load(std::memory_order_acquire);
+    if (chunk_offset >= capacity) {
+      if (!_grow(capacity)) return std::nullopt;
+      chunk_offset = state.reserved_rows.load(std::memory_order_relaxed);
+      continue;
+    }
+    const auto reserved_count = static_cast<uint32_t>(std::min(count, size_t{capacity - chunk_offset}));
+    if (state.reserved_rows.compare_exchange_weak(chunk_offset, chunk_offset + reserved_count,
+                                                  std::memory_order_relaxed)) {
+      return std::make_pair(ChunkOffset{chunk_offset}, ChunkOffset{reserved_count});
+    }
+  }
+}
+
+bool Chunk::_grow(uint32_t observed_capacity) {
+  auto& state = *_append_state;
+  std::lock_guard<std::mutex> lock(state.grow_mutex);
+  const auto capacity = state.capacity.load(std::memory_order_relaxed);
+  if (capacity != observed_capacity) return true;
+  if (capacity >= state.max_capacity.load(std::memory_order_relaxed)) return false;
+
+  // All rows up to the capacity are reserved. Growing copies the committed rows into a new buffer, so rows that are
+  // still being written have to be committed first.
+  while (state.committed_rows.load(std::memory_order_acquire) != capacity) std::this_thread::yield();
+  const auto new_capacity =
+      static_cast<uint32_t>(std::min(uint64_t{capacity} * 2, uint64_t{state.max_capacity.load()}));
+  for (const auto& segment : _segments) static_cast<BaseValueSegment&>(*segment).presize(new_capacity);
+  state.capacity.store(new_capacity, std::memory_order_release);
+  return true;
+}
+
+void Chunk::_commit_rows(ChunkOffset chunk_offset, ChunkOffset count) {
+  auto& state = *_append_state;
+  while (state.committed_rows.load(std::memory_order_acquire) != chunk_offset) std::this_thread::yield();
+  // size() reads the first segment, so it is committed last and never reports rows other segments do not show yet
+  for (auto column_id = _segments.size(); column_id > 0; --column_id) {
+    static_cast<BaseValueSegment&>(*_segments[column_id - 1]).commit(chunk_offset + count);
+  }
+  state.committed_rows.store(chunk_offset + count, std::memory_order_release);
+}
+
+void Chunk::seal() {
+  if (!_append_state) {
+    _is_sealed = true;
+    return;
+  }
+
+  // taking all free rows and preventing growth makes further reservations fail, rows reserved before still have to be
+  // committed
+  auto& state = *_append_state;
+  auto reserved_rows = uint32_t{0};
+  {
+    std::lock_guard<std::mutex> lock(state.grow_mutex);
+    const auto capacity = state.capacity.load(std::memory_order_relaxed);
+    state.max_capacity.store(capacity);
+    reserved_rows = state.reserved_rows.exchange(capacity);
+  }
+  while (state.committed_rows.load(std::memory_order_acquire) != reserved_rows) std::this_thread::yield();
+}
+
+bool Chunk::is_sealed() const {
+  if (!_append_state) return _is_sealed;
+  return _append_state->reserved_rows.load(std::memory_order_relaxed) >= _append_state->max_capacity.load();
+}
+
+void Chunk::mark_compressed() { _is_compressed = true; }
+
+bool Chunk::is_compressed() const { return _is_compressed; }
+
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { return _segments.at(column_id); }
 
+void Chunk::add_segment_filter(ColumnID column_id, std::shared_ptr<const BaseSegmentFilter> filter) {
+  auto filters = segment_filters(column_id);
+  filters.push_back(filter);
+  std::atomic_store(&_segment_filters.at(column_id),
+                    std::make_shared<const std::vector<std::shared_ptr<const BaseSegmentFilter>>>(std::move(filters)));
+}
+
+std::vector<std::shared_ptr<const BaseSegmentFilter>> Chunk::segment_filters(ColumnID column_id) const {
+  const auto filters = std::atomic_load(&_segment_filters.at(column_id));
+  if (!filters) return {};
+  return *filters;
+}
+
+bool Chunk::can_prune(ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto filters = std::atomic_load(&_segment_filters.at(column_id));
+  if (!filters) return false;
+  return std::any_of(filters->cbegin(), filters->cend(),
+                     [&](const auto& filter) { return filter->can_prune(scan_type, search_value); });
+}
+
 uint16_t Chunk::column_count() const { return _segments.size(); }
 
 uint32_t Chunk::size() const {
@@ -5,7 +5,10 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -15,6 +18,8 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class BaseSegmentFilter;
+class BaseValueSegment;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -29,7 +34,10 @@ class Chunk : private Noncopyable {
   Chunk(Chunk&&) = default;
   Chunk& operator=(Chunk&&) = default;
 
-  // adds a segment to the "right" of the chunk
+  // the number of rows that the segments of a pre-sized chunk allocate before they grow for the first time
+  static constexpr auto INITIAL_PRESIZED_CAPACITY = ChunkOffset{1024};
+
+  // adds a segment to the "right" of the chunk, a pre-sized chunk pre-sizes the segment as well
   void add_segment(std::shared_ptr<BaseSegment> segment);
 
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
@@ -42,11 +50,98 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Prepares an empty chunk of ValueSegments for try_append() with room for up to capacity rows. The segments start
+  // with INITIAL_PRESIZED_CAPACITY rows and double whenever they are full, so chunks that only receive few rows stay
+  // small.
+  void presize(ChunkOffset capacity);
+
+  // Adds a new row to a pre-sized chunk. It is safe to call concurrently: each call reserves its own row, writes the
+  // values to it, and commits it once all rows before it are committed, so that readers always see a gap-free prefix.
+  // Returns the offset of the row, or nothing if the chunk is full or has not been pre-sized. If a value cannot be
+  // converted to the data type of its column, it throws without reserving a row.
+  std::optional<ChunkOffset> try_append(const std::vector<AllTypeVariant>& values);
+
+  // Adds count rows, starting at first_row of the given ValueSegments, which hold one column each. The values are
+  // copied range by range instead of row by row.
+  // note this is not thread-safe, use try_append_segments() on pre-sized chunks instead
+  void append_segments(const std::vector<std::shared_ptr<const BaseValueSegment>>& segments, size_t first_row,
+                       size_t count);
+
+  // Like try_append(), but reserves and commits up to count rows of the given ValueSegments at once. If fewer rows
+  // are free, only those are appended. Returns the offset of the first row and the number of rows appended, or
+  // nothing if the chunk is full or has not been pre-sized.
+  std::optional<std::pair<ChunkOffset, ChunkOffset>> try_append_segments(
+      const std::vector<std::shared_ptr<const BaseValueSegment>>& segments, size_t first_row, size_t count);
+
+  // Closes the chunk for appends and waits until all rows that have been reserved are committed. Afterwards, the
+  // chunk does not change anymore: try_append() returns nothing and append() fails.
+  // note for chunks that are not pre-sized, this is not thread-safe with respect to append()
+  void seal();
+
+  // returns whether no more rows can be appended, i.e., the chunk has been sealed or its pre-sized rows are all taken
+  bool is_sealed() const;
+
+  // Marks the chunk as the result of compressing another chunk. Compressed chunks are not compressed again, even if
+  // all of their segments have been left unencoded.
+  void mark_compressed();
+
+  // returns whether the chunk has been marked as compressed
+  bool is_compressed() const;
+
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Adds a filter (e.g., a zone map) that summarizes the segment at a given position. The filters of a segment are
+  // replaced as a whole, so readers may call can_prune() concurrently. Adding filters for the same segment
+  // concurrently is not supported.
+  void add_segment_filter(ColumnID column_id, std::shared_ptr<const BaseSegmentFilter> filter);
+
+  // returns the filters of the segment at a given position
+  std::vector<std::shared_ptr<const BaseSegmentFilter>> segment_filters(ColumnID column_id) const;
+
+  // returns true if a filter of the segment at a given position rules out that any row satisfies the predicate
+  bool can_prune(ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value) const;
+
  protected:
+  // Rows are reserved by incrementing reserved_rows and become visible in the order of their offsets.
+  // committed_rows is the number of visible rows, a writer waits for it to reach its offset before committing.
+  // Only the capacity rows allocated in the segments can be reserved. Once they are taken, the writer that holds
+  // grow_mutex waits for them to be committed and doubles the capacity, up to max_capacity. seal() lowers
+  // max_capacity to the current capacity.
+  struct AppendState {
+    AppendState(const ChunkOffset init_capacity, const ChunkOffset init_max_capacity)
+        : capacity(init_capacity), max_capacity(init_max_capacity) {}
+
+    std::atomic<uint32_t> capacity;
+    std::atomic<uint32_t> max_capacity;
+    std::atomic<uint32_t> reserved_rows{0};
+    std::atomic<uint32_t> committed_rows{0};
+    std::mutex grow_mutex;
+  };
+
   std::vector<std::shared_ptr<BaseSegment>> _segments;
+  // immutable filters of each segment, null if there are none, accessed through std::atomic_load and atomic_store
+  std::vector<std::shared_ptr<const std::vector<std::shared_ptr<const BaseSegmentFilter>>>> _segment_filters;
+
+  // only set for pre-sized chunks, held by a unique_ptr to keep chunks movable
+  std::unique_ptr<AppendState> _append_state;
+
+  // only used for chunks that are not pre-sized, which track whether they are sealed in _append_state otherwise
+  bool _is_sealed = false;
+
+  bool _is_compressed = false;
+
+ private:
+  // reserves up to count rows, growing the segments if all allocated rows are taken
+  // returns the offset of the first row and the number of rows, or nothing if the chunk is full
+  std::optional<std::pair<ChunkOffset, ChunkOffset>> _reserve_rows(size_t count);
+
+  // Doubles the capacity, unless another writer has already changed it from observed_capacity. Returns false if the
+  // chunk cannot grow anymore.
+  bool _grow(uint32_t observed_capacity);
+
+  // waits until all rows before chunk_offset are committed, then commits the next count rows
+  void _commit_rows(ChunkOffset chunk_offset, ChunkOffset count);
 };
 
 }  // namespace opossum
@@ -4,12 +4,21 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <string_view>  // NOLINT(build/include_order)
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "bit_packed_attribute_vector.hpp"
 #include "fixed_size_attribute_vector.hpp"
+#include "front_coded_dictionary.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
+#include "utils/parallel_sort.hpp"
+#include "value_segment.hpp"
 
 namespace opossum {
 
@@ -20,37 +29,83 @@ class BaseSegment;
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
-// Dictionary is a specific segment type that stores all its values in a vector
+// Dictionary is a specific segment type that stores all its values in a vector. String dictionaries are front-coded
+// to avoid the per-string overhead of std::string.
 template <typename T>
 class DictionarySegment : public BaseSegment {
  public:
+  using Dictionary = std::conditional_t<std::is_same_v<T, std::string>, FrontCodedDictionary, std::vector<T>>;
+
+  // Dictionaries with at least this many distinct values are sorted using multiple threads
+  static constexpr auto PARALLEL_SORT_THRESHOLD = size_t{1'000'000};
+
+  // Most segments have far fewer distinct values than rows, so the map of distinct values starts with at most this
+  // many buckets and grows only if needed
+  static constexpr auto MAX_RESERVED_DISTINCT_VALUES = size_t{65'536};
+
   /**
-   *  Creates a Dictionary segment from a given value segment.
-   * Todo: Dictionary segment are we narrowing the constructors functionality to much? 
+   * Creates a Dictionary segment from a given value segment.
+   *
+   * The distinct values are collected with a hash map that assigns each of them a temporary id in order of first
+   * occurrence, which is also recorded for every row. Only the distinct values are sorted. Afterwards, a lookup table
+   * translates the temporary ids into the final value ids, so no row needs a binary search. For strings, the hash map
+   * holds string_views into the value segment, so no string is copied before the dictionary is built.
    */
   explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment) {
     auto segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
     DebugAssert(segment, "Invalid base segment for dictionary segment");
-    auto segment_values = segment->values();
-
-    // create dictionary
-    _dictionary = std::make_shared<std::vector<T>>(segment_values);
-    std::sort(_dictionary->begin(), _dictionary->end());
-    _dictionary->erase(std::unique(_dictionary->begin(), _dictionary->end()), _dictionary->end());
-
-    // create attribute vector with minimal width
-    if (unique_values_count() <= UINT8_MAX) {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint8_t>>(segment->size());
-    } else if (unique_values_count() <= UINT16_MAX) {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint16_t>>(segment->size());
+    const auto& segment_values = segment->values();
+    DebugAssert(segment_values.size() <= std::numeric_limits<uint32_t>::max(), "Too many rows for a segment");
+
+    using Key = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+    // collect the distinct values and the temporary id of every row
+    auto distinct_value_ids = std::unordered_map<Key, uint32_t>{};
+    distinct_value_ids.reserve(std::min(segment_values.size(), MAX_RESERVED_DISTINCT_VALUES));
+    auto distinct_values = std::vector<std::pair<Key, uint32_t>>{};
+    auto row_value_ids = std::vector<uint32_t>(segment_values.size());
+    for (auto row = size_t{0}; row < segment_values.size(); ++row) {
+      const auto key = Key{segment_values[row]};
+      const auto inserted = distinct_value_ids.try_emplace(key, static_cast<uint32_t>(distinct_values.size()));
+      if (inserted.second) distinct_values.emplace_back(key, inserted.first->second);
+      row_value_ids[row] = inserted.first->second;
+    }
+
+    const auto compare_keys = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+    if (distinct_values.size() >= PARALLEL_SORT_THRESHOLD) {
+      parallel_sort(distinct_values.begin(), distinct_values.end(), compare_keys);
     } else {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint32_t>>(segment->size());
+      std::sort(distinct_values.begin(), distinct_values.end(), compare_keys);
     }
 
-    //fill attribute vector with valueIDs
-    for(size_t position = 0; position < segment->size(); position++) {
-      auto value_id = ValueID(std::distance(_dictionary->begin(), std::lower_bound(_dictionary->begin(), _dictionary->end(), segment_values[position])));
-      _attribute_vector->set(position, value_id);
+    // translate the temporary ids into value ids, reusing the row buffer
+    auto value_ids = std::vector<uint32_t>(distinct_values.size());
+    auto dictionary_values = std::vector<T>{};
+    dictionary_values.reserve(distinct_values.size());
+    for (auto value_id = uint32_t{0}; value_id < distinct_values.size(); ++value_id) {
+      value_ids[distinct_values[value_id].second] = value_id;
+      dictionary_values.emplace_back(distinct_values[value_id].first);
+    }
+    for (auto& row_value_id : row_value_ids) row_value_id = value_ids[row_value_id];
+
+    // create attribute vector with minimal width. Value ids that exactly fill a native integer are stored unpacked,
+    // as bit-packing would not save any memory there but make every access more expensive.
+    const auto bit_width = BitPackedAttributeVector::required_bit_width(dictionary_values.size());
+    if (bit_width == 8) {
+      _attribute_vector = _make_fixed_size_attribute_vector<uint8_t>(row_value_ids);
+    } else if (bit_width == 16) {
+      _attribute_vector = _make_fixed_size_attribute_vector<uint16_t>(row_value_ids);
+    } else if (bit_width == 32) {
+      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint32_t>>(std::move(row_value_ids));
+    } else {
+      _attribute_vector = std::make_shared<BitPackedAttributeVector>(row_value_ids, bit_width);
+    }
+
+    if constexpr (std::is_same_v<T, std::string>) {
+      _dictionary = std::make_shared<FrontCodedDictionary>(dictionary_values,
+                                                           FrontCodedDictionary::train_symbol_table(dictionary_values));
+    } else {
+      _dictionary = std::make_shared<std::vector<T>>(std::move(dictionary_values));
     }
   }
 
@@ -59,11 +114,11 @@ class DictionarySegment : public BaseSegment {
 
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override {
-    return value_by_value_id(ValueID(_attribute_vector->get(chunk_offset)));
+    return _value_by_value_id(ValueID(_attribute_vector->get(chunk_offset)));
   }
 
   // return the value at a certain position.
-  T get(const size_t chunk_offset) const { return value_by_value_id(ValueID(_attribute_vector->get(chunk_offset))); }
+  T get(const size_t chunk_offset) const { return _value_by_value_id(ValueID(_attribute_vector->get(chunk_offset))); }
 
   // dictionary segments are immutable
   void append(const AllTypeVariant&) override {
@@ -71,39 +126,54 @@ class DictionarySegment : public BaseSegment {
   }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary; }
+  std::shared_ptr<const Dictionary> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
   std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
+  T value_by_value_id(ValueID value_id) const {
+    Assert(value_id < _dictionary->size(), "ValueID out of range");
+    return _value_by_value_id(value_id);
+  }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
   ValueID lower_bound(T value) const {
-    auto lower_bound = std::lower_bound(_dictionary->begin(), _dictionary->end(), value);
-    if (lower_bound == _dictionary->end()) {
+    size_t lower_bound;
+    if constexpr (std::is_same_v<T, std::string>) {
+      lower_bound = _dictionary->lower_bound(value);
+    } else {
+      lower_bound =
+          std::distance(_dictionary->begin(), std::lower_bound(_dictionary->begin(), _dictionary->end(), value));
+    }
+    if (lower_bound == _dictionary->size()) {
       return INVALID_VALUE_ID;
     }
-    return ValueID(std::distance(_dictionary->begin(), lower_bound));
+    return ValueID(lower_bound);
   }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
-  ValueID lower_bound(const AllTypeVariant& value) const { return lower_bound(static_cast<T>(value)); }
+  ValueID lower_bound(const AllTypeVariant& value) const { return lower_bound(type_cast<T>(value)); }
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
   ValueID upper_bound(T value) const {
-    auto upper_bound = std::upper_bound(_dictionary->begin(), _dictionary->end(), value);
-    if (upper_bound == _dictionary->end()) {
+    size_t upper_bound;
+    if constexpr (std::is_same_v<T, std::string>) {
+      upper_bound = _dictionary->upper_bound(value);
+    } else {
+      upper_bound =
+          std::distance(_dictionary->begin(), std::upper_bound(_dictionary->begin(), _dictionary->end(), value));
+    }
+    if (upper_bound == _dictionary->size()) {
       return INVALID_VALUE_ID;
     }
-    return ValueID(std::distance(_dictionary->begin(), upper_bound));
+    return ValueID(upper_bound);
   }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
-  ValueID upper_bound(const AllTypeVariant& value) const { return upper_bound(static_cast<T>(value)); }
+  ValueID upper_bound(const AllTypeVariant& value) const { return upper_bound(type_cast<T>(value)); }
 
   // return the number of unique_values (dictionary entries)
   size_t unique_values_count() const { return _dictionary->size(); }
@@ -113,11 +183,29 @@ class DictionarySegment : public BaseSegment {
 
   // returns the calculated memory usage
   size_t estimate_memory_usage() const final {
-    return _dictionary->size() * sizeof(T) + _attribute_vector->size() * _attribute_vector->width();
+    if constexpr (std::is_same_v<T, std::string>) {
+      return _dictionary->estimate_memory_usage() + _attribute_vector->estimate_memory_usage();
+    } else {
+      return _dictionary->size() * sizeof(T) + _attribute_vector->estimate_memory_usage();
+    }
   }
 
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  // like value_by_value_id, but without a range check in release builds, for value ids read from the attribute vector
+  T _value_by_value_id(ValueID value_id) const {
+    DebugAssert(value_id < _dictionary->size(), "ValueID out of range");
+    return (*_dictionary)[value_id];
+  }
+
+  template <typename ValueIDType>
+  static std::shared_ptr<BaseAttributeVector> _make_fixed_size_attribute_vector(
+      const std::vector<uint32_t>& row_value_ids) {
+    auto value_ids = std::vector<ValueIDType>(row_value_ids.size());
+    std::copy(row_value_ids.cbegin(), row_value_ids.cend(), value_ids.begin());
+    return std::make_shared<FixedSizeAttributeVector<ValueIDType>>(std::move(value_ids));
+  }
+
+  std::shared_ptr<Dictionary> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
@@ -0,0 +1,177 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "front_coded_dictionary.hpp"
+#include "fsst_symbol_table.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/bit_packing.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Strings up to this length are stored inline (small string optimization) and need no heap allocation
+constexpr auto INLINE_STRING_CAPACITY = size_t{15};
+
+size_t string_heap_size(const std::string& value) {
+  return value.size() > INLINE_STRING_CAPACITY ? value.size() + 1 : 0;
+}
+
+// returns the size of the attribute vector a DictionarySegment with distinct_count values would use
+size_t attribute_vector_size(const size_t row_count, const size_t distinct_count) {
+  const auto bit_width = BitPackedAttributeVector::required_bit_width(distinct_count);
+  if (bit_width == 8 || bit_width == 16 || bit_width == 32) return row_count * (bit_width / 8);
+  return packed_word_count(row_count, bit_width) * sizeof(uint64_t);
+}
+
+template <typename T>
+std::map<EncodingType, size_t> estimate_memory_usage_impl(const ValueSegment<T>& value_segment) {
+  const auto& values = value_segment.values();
+  const auto row_count = values.size();
+  if (row_count == 0) return {{EncodingType::Unencoded, 0}};
+
+  // Pick the sample blocks. Blocks are contiguous so that runs and value ranges are preserved.
+  const auto block_count = (row_count + EncodingAdvisor::SAMPLE_BLOCK_SIZE - 1) / EncodingAdvisor::SAMPLE_BLOCK_SIZE;
+  const auto sample_block_count = std::min(block_count, EncodingAdvisor::MAX_SAMPLE_BLOCKS);
+
+  auto value_counts = std::unordered_map<T, size_t>{};
+  auto sample_size = size_t{0};
+  auto sample_run_count = size_t{0};
+  auto sample_offset_bits = size_t{0};
+  auto sample_characters = size_t{0};
+  auto sample_heap_size = size_t{0};
+
+  for (auto sample_block = size_t{0}; sample_block < sample_block_count; ++sample_block) {
+    const auto block = sample_block * block_count / sample_block_count;
+    const auto begin = block * EncodingAdvisor::SAMPLE_BLOCK_SIZE;
+    const auto end = std::min(row_count, begin + EncodingAdvisor::SAMPLE_BLOCK_SIZE);
+
+    sample_size += end - begin;
+    ++sample_run_count;
+    for (auto index = begin; index < end; ++index) {
+      ++value_counts[values[index]];
+      if (index > begin && values[index] != values[index - 1]) ++sample_run_count;
+      if constexpr (std::is_same_v<T, std::string>) {
+        sample_characters += values[index].size();
+        sample_heap_size += string_heap_size(values[index]);
+      }
+    }
+
+    if constexpr (std::is_integral_v<T>) {
+      const auto minmax = std::minmax_element(values.cbegin() + begin, values.cbegin() + end);
+      const auto range = static_cast<uint64_t>(*minmax.second) - static_cast<uint64_t>(*minmax.first);
+      sample_offset_bits += (end - begin) * packed_bit_width(range);
+    }
+  }
+
+  // Extrapolate from the sample to the whole segment. The distinct count uses the GEE estimator: values seen more than
+  // once in the sample are assumed to be common and are counted once, values seen exactly once are scaled up by
+  // sqrt(row_count / sample_size).
+  const auto scale = static_cast<double>(row_count) / static_cast<double>(sample_size);
+  const auto sample_distinct_count = value_counts.size();
+  const auto singleton_count = static_cast<size_t>(
+      std::count_if(value_counts.cbegin(), value_counts.cend(), [](const auto& entry) { return entry.second == 1; }));
+  const auto estimated_distinct_count = std::clamp(
+      static_cast<size_t>(std::sqrt(scale) * singleton_count) + (sample_distinct_count - singleton_count),
+      sample_distinct_count, row_count);
+  const auto estimated_run_count = std::min(row_count, static_cast<size_t>(sample_run_count * scale));
+
+  auto estimates = std::map<EncodingType, size_t>{};
+  const auto attribute_vector = attribute_vector_size(row_count, estimated_distinct_count);
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto heap_size_per_value = static_cast<double>(sample_heap_size) / sample_size;
+    estimates[EncodingType::Unencoded] =
+        row_count * sizeof(std::string) + static_cast<size_t>(heap_size_per_value * row_count);
+    estimates[EncodingType::RunLength] = estimated_run_count * (sizeof(std::string) + sizeof(ChunkOffset)) +
+                                         static_cast<size_t>(heap_size_per_value * estimated_run_count);
+
+    // The symbol table is trained on the sample only, which is also what FSSTSymbolTable::build() does internally
+    auto sample_values = std::vector<std::string>{};
+    sample_values.reserve(sample_distinct_count);
+    for (const auto& entry : value_counts) sample_values.push_back(entry.first);
+    const auto symbol_table = FSSTSymbolTable::build(sample_values);
+    const auto compression_ratio = symbol_table->compression_ratio();
+    const auto characters = static_cast<double>(sample_characters) * scale;
+    estimates[EncodingType::FSST] = static_cast<size_t>(characters * compression_ratio) +
+                                    (row_count + 1) * sizeof(uint32_t) + symbol_table->estimate_memory_usage();
+
+    // Front coding stores only the suffix that differs from the previous value in sorted order
+    std::sort(sample_values.begin(), sample_values.end());
+    auto suffix_characters = size_t{0};
+    for (auto index = size_t{0}; index < sample_values.size(); ++index) {
+      auto prefix_length = size_t{0};
+      if (index % FrontCodedDictionary::BLOCK_SIZE != 0) {
+        const auto& previous = sample_values[index - 1];
+        const auto& current = sample_values[index];
+        const auto max_prefix_length = std::min(previous.size(), current.size());
+        while (prefix_length < max_prefix_length && previous[prefix_length] == current[prefix_length]) {
+          ++prefix_length;
+        }
+      }
+      // two bytes for the varint-encoded prefix and suffix lengths
+      suffix_characters += sample_values[index].size() - prefix_length + 2;
+    }
+    auto dictionary_characters =
+        static_cast<double>(suffix_characters) / sample_distinct_count * estimated_distinct_count;
+    if (dictionary_characters >= FrontCodedDictionary::MIN_CHARACTERS_FOR_SYMBOL_TABLE &&
+        compression_ratio <= FrontCodedDictionary::MAX_SYMBOL_TABLE_COMPRESSION_RATIO) {
+      dictionary_characters *= compression_ratio;
+    }
+    const auto dictionary_block_count =
+        (estimated_distinct_count + FrontCodedDictionary::BLOCK_SIZE - 1) / FrontCodedDictionary::BLOCK_SIZE;
+    estimates[EncodingType::Dictionary] =
+        static_cast<size_t>(dictionary_characters) + dictionary_block_count * sizeof(size_t) + attribute_vector;
+  } else {
+    estimates[EncodingType::Unencoded] = row_count * sizeof(T);
+    estimates[EncodingType::RunLength] = estimated_run_count * (sizeof(T) + sizeof(ChunkOffset));
+    estimates[EncodingType::Dictionary] = estimated_distinct_count * sizeof(T) + attribute_vector;
+
+    if constexpr (std::is_integral_v<T>) {
+      // the minimum, the bit width, and the word offset are stored per block
+      const auto offset_bits = static_cast<size_t>(sample_offset_bits * scale);
+      estimates[EncodingType::FrameOfReference] = (offset_bits / BITS_PER_WORD + block_count + 1) * sizeof(uint64_t) +
+                                                  block_count * (sizeof(T) + sizeof(uint8_t) + sizeof(size_t));
+    }
+  }
+
+  return estimates;
+}
+
+}  // namespace
+
+std::map<EncodingType, size_t> EncodingAdvisor::estimate_memory_usage(
+    const std::string& column_type, const std::shared_ptr<const BaseSegment>& value_segment) {
+  auto estimates = std::map<EncodingType, size_t>{};
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    const auto typed_segment = std::dynamic_pointer_cast<const ValueSegment<Type>>(value_segment);
+    Assert(typed_segment, "EncodingAdvisor expects a ValueSegment of type " + column_type);
+    estimates = estimate_memory_usage_impl(*typed_segment);
+  });
+  return estimates;
+}
+
+EncodingType EncodingAdvisor::choose_encoding(const std::string& column_type,
+                                              const std::shared_ptr<const BaseSegment>& value_segment) {
+  const auto estimates = estimate_memory_usage(column_type, value_segment);
+
+  // On ties, the encoding that comes first in EncodingType wins, so a segment is only encoded if that saves memory
+  const auto smallest = std::min_element(estimates.cbegin(), estimates.cend(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second < rhs.second;
+  });
+  return smallest->first;
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// The EncodingAdvisor picks an encoding for a ValueSegment before it is compressed. Instead of encoding the segment
+// with every applicable encoding, it inspects a sample of the segment (up to MAX_SAMPLE_BLOCKS contiguous blocks of
+// SAMPLE_BLOCK_SIZE rows, spread evenly across the segment) and extrapolates the number of distinct values, the number
+// of runs, the value range per frame-of-reference block, and the string lengths to the whole segment. From these, it
+// estimates the memory usage of each encoding and chooses the smallest one.
+class EncodingAdvisor {
+ public:
+  static constexpr auto SAMPLE_BLOCK_SIZE = ChunkOffset{2048};
+  static constexpr auto MAX_SAMPLE_BLOCKS = size_t{16};
+
+  // returns the estimated memory usage in bytes of each encoding that supports the column type
+  static std::map<EncodingType, size_t> estimate_memory_usage(const std::string& column_type,
+                                                              const std::shared_ptr<const BaseSegment>& value_segment);
+
+  // returns the encoding with the smallest estimated memory usage
+  static EncodingType choose_encoding(const std::string& column_type,
+                                      const std::shared_ptr<const BaseSegment>& value_segment);
+};
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// All encodings a segment can be stored with. Unencoded refers to a plain ValueSegment. Reference refers to a
+// ReferenceSegment, e.g., in the output of a scan, whose values are stored in another table and cannot be encoded.
+enum class EncodingType { Unencoded, Dictionary, RunLength, FrameOfReference, FSST, Reference };
+
+// returns a human-readable name of an encoding, e.g., for printing the encodings of a table
+std::string encoding_type_to_string(const EncodingType encoding_type);
+
+// Describes how a segment of a table is encoded and how much memory it needs, e.g., to audit the encodings chosen by
+// the EncodingAdvisor.
+struct SegmentEncodingInfo {
+  ChunkID chunk_id;
+  ColumnID column_id;
+  EncodingType encoding_type;
+  size_t memory_usage;
+};
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#include "fixed_size_attribute_vector.hpp"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace opossum {
+
+static_assert(sizeof(ValueID) == sizeof(uint32_t), "Widening assumes that ValueIDs are plain 32-bit integers");
+
+namespace detail {
+
+void widen_value_ids(const uint8_t* input, const size_t count, ValueID* output) {
+  auto index = size_t{0};
+
+#if defined(__AVX2__)
+  for (; index + 16 <= count; index += 16) {
+    const auto narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index), _mm256_cvtepu8_epi32(narrow));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index + 8),
+                        _mm256_cvtepu8_epi32(_mm_srli_si128(narrow, 8)));
+  }
+#elif defined(__SSE2__)
+  const auto zero = _mm_setzero_si128();
+  for (; index + 16 <= count; index += 16) {
+    const auto narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+    const auto low = _mm_unpacklo_epi8(narrow, zero);
+    const auto high = _mm_unpackhi_epi8(narrow, zero);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), _mm_unpacklo_epi16(low, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index + 4), _mm_unpackhi_epi16(low, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index + 8), _mm_unpacklo_epi16(high, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index + 12), _mm_unpackhi_epi16(high, zero));
+  }
+#endif
+
+  for (; index < count; ++index) {
+    output[index] = ValueID{input[index]};
+  }
+}
+
+void widen_value_ids(const uint16_t* input, const size_t count, ValueID* output) {
+  auto index = size_t{0};
+
+#if defined(__AVX2__)
+  for (; index + 8 <= count; index += 8) {
+    const auto narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index), _mm256_cvtepu16_epi32(narrow));
+  }
+#elif defined(__SSE2__)
+  const auto zero = _mm_setzero_si128();
+  for (; index + 8 <= count; index += 8) {
+    const auto narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), _mm_unpacklo_epi16(narrow, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index + 4), _mm_unpackhi_epi16(narrow, zero));
+  }
+#endif
+
+  for (; index < count; ++index) {
+    output[index] = ValueID{input[index]};
+  }
+}
+
+}  // namespace detail
+
+}  // namespace opossum
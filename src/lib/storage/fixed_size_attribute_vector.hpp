@@ -1,17 +1,35 @@
 #pragma once
 
+#include <cstring>
+#include <utility>
 #include <vector>
+
 #include "base_attribute_vector.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace detail {
+
+// Widen count narrow value ids to ValueIDs. These use SIMD instructions where the target supports them.
+void widen_value_ids(const uint8_t* input, const size_t count, ValueID* output);
+void widen_value_ids(const uint16_t* input, const size_t count, ValueID* output);
+
+}  // namespace detail
+
 template <typename T>
 class FixedSizeAttributeVector : public BaseAttributeVector {
  public:
   explicit FixedSizeAttributeVector(const size_t size) { _attribute_vector = std::vector<T>(size); }
 
+  // takes ownership of already computed value ids
+  explicit FixedSizeAttributeVector(std::vector<T>&& value_ids) : _attribute_vector(std::move(value_ids)) {}
+
   // returns the value id at a given position
-  ValueID get(const size_t i) const override { return ValueID(_attribute_vector.at(i)); }
+  ValueID get(const size_t i) const override {
+    DebugAssert(i < _attribute_vector.size(), "Position out of range");
+    return ValueID(_attribute_vector[i]);
+  }
 
   // sets the value id at a given position
   void set(const size_t i, const ValueID value_id) override { _attribute_vector.at(i) = value_id; }
@@ -22,6 +40,24 @@ class FixedSizeAttributeVector : public BaseAttributeVector {
   // returns the width of biggest value id in bytes
   AttributeVectorWidth width() const override { return AttributeVectorWidth(sizeof(T)); }
 
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const override { return _attribute_vector.size() * sizeof(T); }
+
+  // decodes the value ids at the positions [begin, end) into output, which is resized to end - begin
+  void decode(const size_t begin, const size_t end, std::vector<ValueID>& output) const override {
+    DebugAssert(begin <= end && end <= _attribute_vector.size(), "Invalid range");
+    output.resize(end - begin);
+    if constexpr (sizeof(T) == sizeof(ValueID)) {
+      std::memcpy(static_cast<void*>(output.data()), _attribute_vector.data() + begin, (end - begin) * sizeof(T));
+    } else {
+      detail::widen_value_ids(_attribute_vector.data() + begin, end - begin, output.data());
+    }
+  }
+
+  // Returns the typed value ids. Operators that resolve the width once per segment can work on these directly
+  // without any decoding.
+  const std::vector<T>& values() const { return _attribute_vector; }
+
  private:
   std::vector<T> _attribute_vector;
 };
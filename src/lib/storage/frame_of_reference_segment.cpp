@@ -0,0 +1,163 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/bit_packing.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  DebugAssert(segment, "Invalid base segment for frame-of-reference segment");
+  const auto& segment_values = segment->values();
+  _size = segment_values.size();
+
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_minima.reserve(block_count);
+  _block_bit_widths.reserve(block_count);
+  _block_word_offsets.reserve(block_count);
+
+  // first pass: determine minimum and offset width of each block to size the packed buffer exactly
+  auto word_count = size_t{0};
+  for (auto block_begin = size_t{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+    const auto minmax = std::minmax_element(segment_values.cbegin() + block_begin, segment_values.cbegin() + block_end);
+    const auto minimum = *minmax.first;
+    const auto bit_width = packed_bit_width(static_cast<Offset>(static_cast<Offset>(*minmax.second) - minimum));
+
+    _block_minima.push_back(minimum);
+    _block_bit_widths.push_back(bit_width);
+    _block_word_offsets.push_back(word_count);
+    word_count += (static_cast<size_t>(block_end - block_begin) * bit_width + BITS_PER_WORD - 1) / BITS_PER_WORD;
+  }
+
+  // second pass: pack the offsets
+  _words = std::vector<uint64_t>(word_count + 1);
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_begin = block_index * BLOCK_SIZE;
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+    const auto minimum = static_cast<Offset>(_block_minima[block_index]);
+    const auto bit_width = _block_bit_widths[block_index];
+    auto* const block_words = _words.data() + _block_word_offsets[block_index];
+
+    for (auto index = block_begin; index < block_end; ++index) {
+      const auto offset = static_cast<Offset>(static_cast<Offset>(segment_values[index]) - minimum);
+      write_packed_bits(block_words, (index - block_begin) * bit_width, bit_width, offset);
+    }
+  }
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  return get(chunk_offset);
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _size, "Chunk offset out of range");
+  const auto block_index = chunk_offset / BLOCK_SIZE;
+  const auto bit_width = _block_bit_widths[block_index];
+  // a constant block has no words, so reading it would run past the padding word of the last block
+  if (bit_width == 0) return _block_minima[block_index];
+
+  const auto offset = read_packed_bits(_words.data() + _block_word_offsets[block_index],
+                                       (chunk_offset % BLOCK_SIZE) * bit_width, packed_bit_mask(bit_width));
+  return static_cast<T>(static_cast<Offset>(_block_minima[block_index]) + static_cast<Offset>(offset));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const AllTypeVariant&) {
+  throw std::runtime_error("Tried to call append() on immutable frame-of-reference segment");
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decode(const ChunkOffset begin, const ChunkOffset end, std::vector<T>& output) const {
+  DebugAssert(begin <= end && end <= _size, "Invalid range");
+  output.resize(end - begin);
+
+  auto output_index = size_t{0};
+  auto chunk_offset = begin;
+  while (chunk_offset < end) {
+    const auto block_index = chunk_offset / BLOCK_SIZE;
+    const auto block_end = std::min(static_cast<ChunkOffset>((block_index + 1) * BLOCK_SIZE), end);
+    const auto minimum = static_cast<Offset>(_block_minima[block_index]);
+    const auto bit_width = _block_bit_widths[block_index];
+    const auto mask = packed_bit_mask(bit_width);
+    const auto* const block_words = _words.data() + _block_word_offsets[block_index];
+
+    if (bit_width == 0) {
+      std::fill_n(output.begin() + output_index, block_end - chunk_offset, static_cast<T>(minimum));
+      output_index += block_end - chunk_offset;
+      chunk_offset = block_end;
+      continue;
+    }
+
+    auto bit_position = (chunk_offset % BLOCK_SIZE) * size_t{bit_width};
+    for (; chunk_offset < block_end; ++chunk_offset, ++output_index, bit_position += bit_width) {
+      output[output_index] =
+          static_cast<T>(minimum + static_cast<Offset>(read_packed_bits(block_words, bit_position, mask)));
+    }
+  }
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::block_count() const {
+  return _block_minima.size();
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::block_minimum(const size_t block_index) const {
+  return _block_minima.at(block_index);
+}
+
+template <typename T>
+uint8_t FrameOfReferenceSegment<T>::block_bit_width(const size_t block_index) const {
+  return _block_bit_widths.at(block_index);
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decode_offsets(const size_t block_index, std::vector<Offset>& output) const {
+  DebugAssert(block_index < block_count(), "Block index out of range");
+  const auto block_begin = block_index * BLOCK_SIZE;
+  output.resize(std::min(block_begin + BLOCK_SIZE, _size) - block_begin);
+
+  const auto bit_width = _block_bit_widths[block_index];
+  if (bit_width == 0) {
+    std::fill(output.begin(), output.end(), Offset{0});
+    return;
+  }
+
+  const auto mask = packed_bit_mask(bit_width);
+  const auto* const block_words = _words.data() + _block_word_offsets[block_index];
+
+  auto bit_position = size_t{0};
+  for (auto& offset : output) {
+    offset = static_cast<Offset>(read_packed_bits(block_words, bit_position, mask));
+    bit_position += bit_width;
+  }
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return _words.size() * sizeof(uint64_t) + _block_minima.size() * sizeof(T) +
+         _block_bit_widths.size() * sizeof(uint8_t) + _block_word_offsets.size() * sizeof(size_t);
+}
+
+// Frame-of-reference encoding only applies to integer columns, so EXPLICITLY_INSTANTIATE_DATA_TYPES cannot be used
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
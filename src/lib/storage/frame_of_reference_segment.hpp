@@ -0,0 +1,72 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is a specific segment type for integer columns. It splits the segment into blocks of
+// BLOCK_SIZE rows and stores, for each block, the block's minimum and the offset of each value from that minimum.
+// The offsets are bit-packed with the width needed for the largest offset of the block. This works well for columns
+// with many distinct values that lie in a narrow range (e.g., ids or timestamps), where a dictionary would be as large
+// as the data itself.
+//
+// Range predicates can be evaluated in offset space: for each block, subtract the block minimum from the search value
+// once and compare it against the packed offsets (see decode_offsets()). TableScan does this.
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+  static_assert(std::is_integral_v<T>, "Frame-of-reference encoding is only supported for integer types");
+
+ public:
+  using Offset = std::make_unsigned_t<T>;
+
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+
+  // Creates a frame-of-reference encoded segment from a given value segment.
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // frame-of-reference segments are immutable
+  void append(const AllTypeVariant&) final;
+
+  // decodes the values at the positions [begin, end) into output, which is resized to end - begin
+  void decode(const ChunkOffset begin, const ChunkOffset end, std::vector<T>& output) const;
+
+  // returns the number of blocks
+  size_t block_count() const;
+
+  // returns the minimum of a given block, which all offsets of that block are relative to
+  T block_minimum(const size_t block_index) const;
+
+  // returns the number of bits used for each offset of a given block
+  uint8_t block_bit_width(const size_t block_index) const;
+
+  // decodes the offsets of a given block into output, which is resized to the number of rows in that block
+  void decode_offsets(const size_t block_index, std::vector<Offset>& output) const;
+
+  // return the number of entries
+  size_t size() const final;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  size_t _size;
+  std::vector<T> _block_minima;
+  std::vector<uint8_t> _block_bit_widths;
+  // index of the first word of each block in _words
+  std::vector<size_t> _block_word_offsets;
+  // packed offsets of all blocks, followed by one padding word
+  std::vector<uint64_t> _words;
+};
+
+}  // namespace opossum
@@ -0,0 +1,167 @@
+#include "front_coded_dictionary.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>  // NOLINT(build/include_order)
+#include <utility>
+#include <vector>
+
+#include "fsst_symbol_table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+void append_varint(std::vector<char>& buffer, size_t value) {
+  while (value >= 0x80) {
+    buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  buffer.push_back(static_cast<char>(value));
+}
+
+size_t read_varint(const std::vector<char>& buffer, size_t& position) {
+  auto value = size_t{0};
+  auto shift = 0;
+  while (true) {
+    const auto byte = static_cast<uint8_t>(buffer[position++]);
+    value |= static_cast<size_t>(byte & 0x7F) << shift;
+    if (byte < 0x80) return value;
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+FrontCodedDictionary::FrontCodedDictionary(const std::vector<std::string>& values,
+                                           std::shared_ptr<const FSSTSymbolTable> symbol_table)
+    : _size(values.size()), _symbol_table(std::move(symbol_table)) {
+  DebugAssert(std::is_sorted(values.cbegin(), values.cend()), "Values of a front-coded dictionary must be sorted");
+  _block_offsets.reserve((_size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+  for (auto index = size_t{0}; index < _size; ++index) {
+    const auto& value = values[index];
+    if (index % BLOCK_SIZE == 0) {
+      _block_offsets.push_back(_characters.size());
+      _append_characters(value);
+      continue;
+    }
+
+    const auto& previous = values[index - 1];
+    const auto max_prefix_length = std::min(previous.size(), value.size());
+    auto prefix_length = size_t{0};
+    while (prefix_length < max_prefix_length && previous[prefix_length] == value[prefix_length]) ++prefix_length;
+
+    append_varint(_characters, prefix_length);
+    _append_characters(value.substr(prefix_length));
+  }
+
+  _characters.shrink_to_fit();
+}
+
+std::shared_ptr<const FSSTSymbolTable> FrontCodedDictionary::train_symbol_table(
+    const std::vector<std::string>& values) {
+  auto character_count = size_t{0};
+  for (const auto& value : values) character_count += value.size();
+  if (character_count < MIN_CHARACTERS_FOR_SYMBOL_TABLE) return nullptr;
+
+  auto symbol_table = FSSTSymbolTable::build(values);
+  if (symbol_table->compression_ratio() > MAX_SYMBOL_TABLE_COMPRESSION_RATIO) return nullptr;
+  return symbol_table;
+}
+
+std::string FrontCodedDictionary::operator[](const size_t index) const {
+  DebugAssert(index < _size, "Index out of range");
+  const auto block_index = index / BLOCK_SIZE;
+
+  auto value = std::string{};
+  auto position = _block_offsets[block_index];
+  for (auto block_entry = size_t{0}; block_entry <= index % BLOCK_SIZE; ++block_entry) {
+    position = _decode_next(position, block_entry == 0, value);
+  }
+  return value;
+}
+
+size_t FrontCodedDictionary::lower_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view entry) { return entry >= value; });
+}
+
+size_t FrontCodedDictionary::upper_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view entry) { return entry > value; });
+}
+
+std::shared_ptr<const FSSTSymbolTable> FrontCodedDictionary::symbol_table() const { return _symbol_table; }
+
+size_t FrontCodedDictionary::size() const { return _size; }
+
+size_t FrontCodedDictionary::estimate_memory_usage() const {
+  const auto symbol_table_size = _symbol_table ? _symbol_table->estimate_memory_usage() : size_t{0};
+  return _characters.size() + _block_offsets.size() * sizeof(size_t) + symbol_table_size;
+}
+
+void FrontCodedDictionary::_append_characters(const std::string& characters) {
+  if (!_symbol_table) {
+    append_varint(_characters, characters.size());
+    _characters.insert(_characters.end(), characters.cbegin(), characters.cend());
+    return;
+  }
+
+  const auto compressed = _symbol_table->compress(characters);
+  append_varint(_characters, compressed.size());
+  _characters.insert(_characters.end(), compressed.cbegin(), compressed.cend());
+}
+
+std::string_view FrontCodedDictionary::_block_head(const size_t block_index, std::string& buffer) const {
+  auto position = _block_offsets[block_index];
+  const auto length = read_varint(_characters, position);
+  if (!_symbol_table) return std::string_view{_characters.data() + position, length};
+
+  buffer.clear();
+  _symbol_table->decompress(_characters.data() + position, length, buffer);
+  return buffer;
+}
+
+size_t FrontCodedDictionary::_decode_next(size_t position, const bool is_head, std::string& value) const {
+  const auto prefix_length = is_head ? size_t{0} : read_varint(_characters, position);
+  const auto suffix_length = read_varint(_characters, position);
+  value.resize(prefix_length);
+  if (_symbol_table) {
+    _symbol_table->decompress(_characters.data() + position, suffix_length, value);
+  } else {
+    value.append(_characters.data() + position, suffix_length);
+  }
+  return position + suffix_length;
+}
+
+template <typename Predicate>
+size_t FrontCodedDictionary::_partition_point(const Predicate& is_match) const {
+  // find the first block whose head matches - all entries before it are in the preceding block
+  auto head_buffer = std::string{};
+  auto first_block = size_t{0};
+  auto last_block = _block_offsets.size();
+  while (first_block < last_block) {
+    const auto middle_block = first_block + (last_block - first_block) / 2;
+    if (is_match(_block_head(middle_block, head_buffer))) {
+      last_block = middle_block;
+    } else {
+      first_block = middle_block + 1;
+    }
+  }
+
+  if (first_block == 0) return 0;
+
+  // the head of the preceding block does not match, so scan the rest of it
+  const auto block_index = first_block - 1;
+  const auto block_end = std::min(_size, first_block * BLOCK_SIZE);
+  auto value = std::string{};
+  auto position = _block_offsets[block_index];
+  for (auto index = block_index * BLOCK_SIZE; index < block_end; ++index) {
+    position = _decode_next(position, index % BLOCK_SIZE == 0, value);
+    if (is_match(value)) return index;
+  }
+  return block_end;
+}
+
+}  // namespace opossum
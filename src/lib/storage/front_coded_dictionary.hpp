@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>  // NOLINT(build/include_order)
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class FSSTSymbolTable;
+
+// FrontCodedDictionary is a compact, order-preserving dictionary for strings. It stores all entries in a single,
+// contiguous character buffer, grouped into blocks of BLOCK_SIZE entries. The first entry of each block (the head)
+// is stored in full, every following entry only stores the length of the prefix it shares with its predecessor and
+// the remaining suffix. Lengths are encoded as variable-length integers:
+//
+//   block := varint(head_length) head_characters { varint(prefix_length) varint(suffix_length) suffix_characters }
+//
+// Binary searches only compare block heads, which can be read directly from the buffer without decoding, and then
+// decode at most one block sequentially.
+//
+// Optionally, heads and suffixes are additionally compressed with an FSSTSymbolTable, which removes repeated
+// substrings that front coding does not catch. The stored lengths then refer to the compressed bytes, while prefix
+// lengths still refer to the decompressed values.
+class FrontCodedDictionary : private Noncopyable {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{16};
+
+  // dictionaries with fewer characters do not amortize the size of a symbol table
+  static constexpr auto MIN_CHARACTERS_FOR_SYMBOL_TABLE = size_t{16'384};
+  // symbol tables that compress the values less than this are not worth the slower decoding
+  static constexpr auto MAX_SYMBOL_TABLE_COMPRESSION_RATIO = 0.75;
+
+  // creates a dictionary from sorted, unique values, optionally compressing them with a symbol table
+  explicit FrontCodedDictionary(const std::vector<std::string>& values,
+                                std::shared_ptr<const FSSTSymbolTable> symbol_table = nullptr);
+
+  // returns a symbol table trained on the values if it is expected to shrink the dictionary, nullptr otherwise
+  static std::shared_ptr<const FSSTSymbolTable> train_symbol_table(const std::vector<std::string>& values);
+
+  // returns the value at a given position
+  std::string operator[](const size_t index) const;
+
+  // returns the index of the first value >= the search value or size() if there is none
+  size_t lower_bound(const std::string_view value) const;
+
+  // returns the index of the first value > the search value or size() if there is none
+  size_t upper_bound(const std::string_view value) const;
+
+  // calls functor(index, value) for all values in ascending order, decoding each block only once
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    auto value = std::string{};
+    for (auto block_index = size_t{0}; block_index < _block_offsets.size(); ++block_index) {
+      auto position = _block_offsets[block_index];
+      const auto block_end = std::min(_size, (block_index + 1) * BLOCK_SIZE);
+      for (auto index = block_index * BLOCK_SIZE; index < block_end; ++index) {
+        position = _decode_next(position, index % BLOCK_SIZE == 0, value);
+        functor(index, static_cast<const std::string&>(value));
+      }
+    }
+  }
+
+  // returns the symbol table the values are compressed with, nullptr if they are not
+  std::shared_ptr<const FSSTSymbolTable> symbol_table() const;
+
+  // returns the number of values
+  size_t size() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // appends a head or suffix to the character buffer
+  void _append_characters(const std::string& characters);
+
+  // Returns the head of a block, pointing into the character buffer. If the dictionary is compressed, the head is
+  // decompressed into buffer instead.
+  std::string_view _block_head(const size_t block_index, std::string& buffer) const;
+
+  // Decodes the entry starting at position into value, which has to hold the previous entry of the block unless the
+  // entry is a block head. Returns the position of the next entry.
+  size_t _decode_next(size_t position, const bool is_head, std::string& value) const;
+
+  // returns the index of the first value for which is_match(value) holds, given that is_match is monotonic
+  template <typename Predicate>
+  size_t _partition_point(const Predicate& is_match) const;
+
+  size_t _size;
+  std::shared_ptr<const FSSTSymbolTable> _symbol_table;
+  std::vector<char> _characters;
+  std::vector<size_t> _block_offsets;
+};
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#include "fsst_segment.hpp"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fsst_symbol_table.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+FSSTSegment::FSSTSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto segment = std::dynamic_pointer_cast<ValueSegment<std::string>>(base_segment);
+  DebugAssert(segment, "Invalid base segment for FSST segment");
+  const auto& segment_values = segment->values();
+
+  _symbol_table = FSSTSymbolTable::build(segment_values);
+
+  _offsets.reserve(segment_values.size() + 1);
+  _offsets.push_back(0);
+  for (const auto& value : segment_values) {
+    _symbol_table->compress(value, _compressed_values);
+    Assert(_compressed_values.size() <= std::numeric_limits<uint32_t>::max(), "FSST segment exceeds 4 GB");
+    _offsets.push_back(static_cast<uint32_t>(_compressed_values.size()));
+  }
+
+  _compressed_values.shrink_to_fit();
+}
+
+AllTypeVariant FSSTSegment::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  return get(chunk_offset);
+}
+
+std::string FSSTSegment::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Chunk offset out of range");
+  const auto begin = _offsets[chunk_offset];
+  return _symbol_table->decompress(_compressed_values.data() + begin, _offsets[chunk_offset + 1] - begin);
+}
+
+void FSSTSegment::append(const AllTypeVariant&) {
+  throw std::runtime_error("Tried to call append() on immutable FSST segment");
+}
+
+std::string FSSTSegment::compress(const std::string& value) const { return _symbol_table->compress(value); }
+
+bool FSSTSegment::equals(const ChunkOffset chunk_offset, const std::string& compressed_value) const {
+  DebugAssert(chunk_offset < size(), "Chunk offset out of range");
+  const auto begin = _offsets[chunk_offset];
+  const auto length = _offsets[chunk_offset + 1] - begin;
+  return length == compressed_value.size() &&
+         std::memcmp(_compressed_values.data() + begin, compressed_value.data(), length) == 0;
+}
+
+std::shared_ptr<const FSSTSymbolTable> FSSTSegment::symbol_table() const { return _symbol_table; }
+
+size_t FSSTSegment::size() const { return _offsets.size() - 1; }
+
+size_t FSSTSegment::estimate_memory_usage() const {
+  return _compressed_values.size() + _offsets.size() * sizeof(uint32_t) + _symbol_table->estimate_memory_usage();
+}
+
+}  // namespace opossum
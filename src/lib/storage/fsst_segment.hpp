@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class FSSTSymbolTable;
+
+// FSSTSegment is a specific segment type for string columns that compresses each value individually with a symbol
+// table trained on the segment (see FSSTSymbolTable). The compressed values are stored back to back in one buffer,
+// so single values can be decompressed independently. Equality predicates can be evaluated on the compressed form:
+// compress the search value once and compare it against the compressed values with equals().
+class FSSTSegment : public BaseSegment {
+ public:
+  // Creates an FSST-compressed segment from a given string value segment.
+  explicit FSSTSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position.
+  std::string get(const ChunkOffset chunk_offset) const;
+
+  // FSST segments are immutable
+  void append(const AllTypeVariant&) final;
+
+  // returns the compressed form of a value, which can then be passed to equals()
+  std::string compress(const std::string& value) const;
+
+  // returns whether the value at a certain position equals a value compressed with compress()
+  bool equals(const ChunkOffset chunk_offset, const std::string& compressed_value) const;
+
+  // returns the symbol table used to compress the values
+  std::shared_ptr<const FSSTSymbolTable> symbol_table() const;
+
+  // return the number of entries
+  size_t size() const final;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::shared_ptr<const FSSTSymbolTable> _symbol_table;
+  std::vector<char> _compressed_values;
+  // value i is stored at [_offsets[i], _offsets[i + 1])
+  std::vector<uint32_t> _offsets;
+};
+
+}  // namespace opossum
@@ -0,0 +1,175 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the training sample is limited to this many characters to bound the time needed to build a table
+constexpr auto MAX_SAMPLE_CHARACTERS = size_t{1} << 15;
+constexpr auto TRAINING_GENERATIONS = 5;
+
+std::vector<const std::string*> take_sample(const ValueSpan<std::string>& values) {
+  auto total_characters = size_t{0};
+  for (const auto& value : values) total_characters += value.size();
+
+  // take evenly spread values so that the sample reflects the whole input, not just its beginning
+  const auto stride = std::max(size_t{1}, total_characters / MAX_SAMPLE_CHARACTERS);
+  auto sample = std::vector<const std::string*>{};
+  for (auto index = size_t{0}; index < values.size(); index += stride) sample.push_back(&values[index]);
+  return sample;
+}
+
+}  // namespace
+
+std::shared_ptr<FSSTSymbolTable> FSSTSymbolTable::build(const ValueSpan<std::string>& values) {
+  auto symbol_table = std::make_shared<FSSTSymbolTable>();
+  const auto sample = take_sample(values);
+
+  auto sample_characters = size_t{0};
+  for (const auto* value : sample) sample_characters += value->size();
+
+  for (auto generation = 0; generation < TRAINING_GENERATIONS; ++generation) {
+    // count how often each symbol and each concatenation of two adjacent symbols would be used
+    auto symbol_counts = std::unordered_map<std::string, size_t>{};
+    for (const auto* value : sample) {
+      auto previous_symbol = std::string{};
+      auto position = size_t{0};
+      while (position < value->size()) {
+        const auto code = symbol_table->_find_longest_symbol(*value, position);
+        const auto length = code == ESCAPE_CODE ? size_t{1} : size_t{symbol_table->_symbol_lengths[code]};
+        auto symbol = value->substr(position, length);
+
+        ++symbol_counts[symbol];
+        if (!previous_symbol.empty() && previous_symbol.size() + symbol.size() <= MAX_SYMBOL_LENGTH) {
+          ++symbol_counts[previous_symbol + symbol];
+        }
+
+        previous_symbol = std::move(symbol);
+        position += length;
+      }
+    }
+
+    // keep the candidates that save the most bytes
+    auto candidates = std::vector<std::pair<size_t, std::string>>{};
+    candidates.reserve(symbol_counts.size());
+    for (const auto& symbol_count : symbol_counts) {
+      candidates.emplace_back(symbol_count.second * symbol_count.first.size(), symbol_count.first);
+    }
+
+    const auto symbol_count = std::min(MAX_SYMBOL_COUNT, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + symbol_count, candidates.end(),
+                      [](const auto& lhs, const auto& rhs) {
+                        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+                      });
+
+    auto symbols = std::vector<std::string>{};
+    for (auto index = size_t{0}; index < symbol_count; ++index) symbols.push_back(std::move(candidates[index].second));
+    symbol_table->_set_symbols(symbols);
+  }
+
+  if (sample_characters > 0) {
+    auto compressed = std::vector<char>{};
+    for (const auto* value : sample) symbol_table->compress(*value, compressed);
+    symbol_table->_compression_ratio = static_cast<double>(compressed.size()) / static_cast<double>(sample_characters);
+  }
+
+  return symbol_table;
+}
+
+std::shared_ptr<FSSTSymbolTable> FSSTSymbolTable::build(const std::vector<std::string>& values) {
+  return build(ValueSpan<std::string>{values.data(), values.size()});
+}
+
+std::string FSSTSymbolTable::compress(const std::string& value) const {
+  auto output = std::vector<char>{};
+  compress(value, output);
+  return std::string{output.cbegin(), output.cend()};
+}
+
+size_t FSSTSymbolTable::compress(const std::string& value, std::vector<char>& output) const {
+  const auto initial_size = output.size();
+  auto position = size_t{0};
+  while (position < value.size()) {
+    const auto code = _find_longest_symbol(value, position);
+    output.push_back(static_cast<char>(code));
+    if (code == ESCAPE_CODE) {
+      output.push_back(value[position]);
+      ++position;
+    } else {
+      position += _symbol_lengths[code];
+    }
+  }
+  return output.size() - initial_size;
+}
+
+std::string FSSTSymbolTable::decompress(const char* compressed, const size_t length) const {
+  auto output = std::string{};
+  decompress(compressed, length, output);
+  return output;
+}
+
+void FSSTSymbolTable::decompress(const char* compressed, const size_t length, std::string& output) const {
+  // every code expands to at most eight bytes; writing full words and trimming afterwards avoids a copy per length
+  auto output_position = output.size();
+  output.resize(output_position + length * MAX_SYMBOL_LENGTH + MAX_SYMBOL_LENGTH);
+  for (auto position = size_t{0}; position < length; ++position) {
+    const auto code = static_cast<uint8_t>(compressed[position]);
+    if (code == ESCAPE_CODE) {
+      output[output_position++] = compressed[++position];
+    } else {
+      std::memcpy(&output[output_position], &_symbols[code], MAX_SYMBOL_LENGTH);
+      output_position += _symbol_lengths[code];
+    }
+  }
+  output.resize(output_position);
+}
+
+double FSSTSymbolTable::compression_ratio() const { return _compression_ratio; }
+
+size_t FSSTSymbolTable::symbol_count() const { return _symbols.size(); }
+
+size_t FSSTSymbolTable::estimate_memory_usage() const {
+  return _symbols.size() * (sizeof(uint64_t) + sizeof(uint8_t) * 2);
+}
+
+void FSSTSymbolTable::_set_symbols(const std::vector<std::string>& symbols) {
+  DebugAssert(symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols");
+
+  _symbols.assign(symbols.size(), 0);
+  _symbol_lengths.resize(symbols.size());
+  for (auto& codes : _codes_by_first_byte) codes.clear();
+
+  for (auto code = size_t{0}; code < symbols.size(); ++code) {
+    const auto& symbol = symbols[code];
+    DebugAssert(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH, "Invalid symbol length");
+    std::memcpy(&_symbols[code], symbol.data(), symbol.size());
+    _symbol_lengths[code] = static_cast<uint8_t>(symbol.size());
+    _codes_by_first_byte[static_cast<uint8_t>(symbol[0])].push_back(static_cast<uint8_t>(code));
+  }
+
+  for (auto& codes : _codes_by_first_byte) {
+    std::stable_sort(codes.begin(), codes.end(),
+                     [&](const uint8_t lhs, const uint8_t rhs) { return _symbol_lengths[lhs] > _symbol_lengths[rhs]; });
+  }
+}
+
+uint8_t FSSTSymbolTable::_find_longest_symbol(const std::string& value, const size_t position) const {
+  const auto remaining = value.size() - position;
+  for (const auto code : _codes_by_first_byte[static_cast<uint8_t>(value[position])]) {
+    const auto length = _symbol_lengths[code];
+    if (length <= remaining && std::memcmp(&_symbols[code], value.data() + position, length) == 0) return code;
+  }
+  return ESCAPE_CODE;
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// FSSTSymbolTable implements a self-contained variant of FSST ("Fast Static Symbol Table") string compression.
+// A table holds up to 255 symbols of one to eight bytes. Compression greedily replaces the longest symbol matching
+// at the current position by its one-byte code. Bytes not covered by any symbol are written as the escape code
+// followed by the literal byte. Decompression is a table lookup per code.
+//
+// The table is trained on a sample of the values to compress: starting from an empty table, it repeatedly compresses
+// the sample, counts how often each symbol and each pair of adjacent symbols occurs, and keeps the 255 candidates
+// that save the most bytes.
+//
+// Compression is deterministic, so two strings are equal if and only if their compressed forms are equal. This allows
+// equality predicates to be evaluated without decompressing. The order of compressed strings is not preserved.
+class FSSTSymbolTable : private Noncopyable {
+ public:
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // creates an empty symbol table, which escapes every byte
+  FSSTSymbolTable() = default;
+
+  // trains a symbol table on (a sample of) the given values
+  static std::shared_ptr<FSSTSymbolTable> build(const ValueSpan<std::string>& values);
+  static std::shared_ptr<FSSTSymbolTable> build(const std::vector<std::string>& values);
+
+  // returns the compressed form of a value
+  std::string compress(const std::string& value) const;
+
+  // appends the compressed form of a value to output and returns the number of bytes appended
+  size_t compress(const std::string& value, std::vector<char>& output) const;
+
+  // returns the decompressed form of length compressed bytes
+  std::string decompress(const char* compressed, const size_t length) const;
+
+  // appends the decompressed form of length compressed bytes to output
+  void decompress(const char* compressed, const size_t length, std::string& output) const;
+
+  // returns the compressed size divided by the uncompressed size, as measured on the training sample
+  double compression_ratio() const;
+
+  // returns the number of symbols
+  size_t symbol_count() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // replaces the symbols of the table and rebuilds the lookup structures
+  void _set_symbols(const std::vector<std::string>& symbols);
+
+  // returns the code of the longest symbol matching value at position or ESCAPE_CODE if there is none
+  uint8_t _find_longest_symbol(const std::string& value, const size_t position) const;
+
+  // symbols are stored in eight-byte words so that decompression can always copy a full word at once
+  std::vector<uint64_t> _symbols;
+  std::vector<uint8_t> _symbol_lengths;
+
+  // for each first byte, the codes of all symbols starting with it, longest first
+  std::array<std::vector<uint8_t>, 256> _codes_by_first_byte;
+
+  double _compression_ratio{1.0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#include "pos_list_utils.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+std::shared_ptr<const AbstractPosList> make_single_chunk_pos_list(const ChunkID chunk_id,
+                                                                   const std::vector<ChunkOffset>& chunk_offsets) {
+  if (chunk_offsets.empty()) return std::make_shared<RangePosList>(chunk_id, 0, 0);
+  if (chunk_offsets.back() - chunk_offsets.front() + 1 == chunk_offsets.size()) {
+    return std::make_shared<RangePosList>(chunk_id, chunk_offsets.front(), chunk_offsets.back() + 1);
+  }
+  if (BitmapPosList::estimate_memory_usage(chunk_offsets) < chunk_offsets.size() * sizeof(RowID)) {
+    return std::make_shared<BitmapPosList>(chunk_id, chunk_offsets);
+  }
+
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(chunk_offsets.size());
+  for (const auto chunk_offset : chunk_offsets) pos_list->push_back(RowID{chunk_id, chunk_offset});
+  pos_list->guarantee_single_chunk();
+  return pos_list;
+}
+
+}  // namespace opossum
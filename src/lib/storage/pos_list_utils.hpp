@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "bitmap_pos_list.hpp"
+#include "range_pos_list.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Calls functor with the position list cast to its concrete type, i.e., const PosList&, const RangePosList& or
+// const BitmapPosList&. The compressed representations only hold sorted positions in a single chunk, which they
+// return as chunk_id().
+template <typename Functor>
+void resolve_pos_list_type(const AbstractPosList& pos_list, const Functor& functor) {
+  if (const auto range_pos_list = dynamic_cast<const RangePosList*>(&pos_list)) return functor(*range_pos_list);
+  if (const auto bitmap_pos_list = dynamic_cast<const BitmapPosList*>(&pos_list)) return functor(*bitmap_pos_list);
+  const auto row_id_pos_list = dynamic_cast<const PosList*>(&pos_list);
+  Assert(row_id_pos_list, "Unknown position list type");
+  functor(*row_id_pos_list);
+}
+
+// Returns the smallest representation of the given sorted and unique offsets in a chunk: a RangePosList if they are
+// contiguous, a BitmapPosList if that takes less memory than a PosList, and a PosList otherwise.
+std::shared_ptr<const AbstractPosList> make_single_chunk_pos_list(const ChunkID chunk_id,
+                                                                   const std::vector<ChunkOffset>& chunk_offsets);
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// The positions begin_offset, ..., end_offset - 1 of a single chunk, e.g., all rows of a chunk that matched a scan. It
+// takes a few bytes, regardless of the number of positions.
+class RangePosList final : public AbstractPosList {
+ public:
+  RangePosList(const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset)
+      : _chunk_id(chunk_id), _begin_offset(begin_offset), _end_offset(end_offset) {
+    DebugAssert(begin_offset <= end_offset, "Range of positions must not end before it begins");
+  }
+
+  ChunkID chunk_id() const { return _chunk_id; }
+  ChunkOffset begin_offset() const { return _begin_offset; }
+  ChunkOffset end_offset() const { return _end_offset; }
+
+  size_t size() const final { return _end_offset - _begin_offset; }
+
+  RowID get(const size_t index) const final {
+    DebugAssert(index < size(), "Position out of range");
+    return RowID{_chunk_id, static_cast<ChunkOffset>(_begin_offset + index)};
+  }
+
+  bool references_single_chunk() const final { return true; }
+
+  size_t memory_usage() const final { return sizeof(*this); }
+
+  // calls functor(index, row_id) for every position
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    for (auto chunk_offset = _begin_offset; chunk_offset < _end_offset; ++chunk_offset) {
+      functor(size_t{chunk_offset - _begin_offset}, RowID{_chunk_id, chunk_offset});
+    }
+  }
+
+ protected:
+  const ChunkID _chunk_id;
+  const ChunkOffset _begin_offset;
+  const ChunkOffset _end_offset;
+};
+
+}  // namespace opossum
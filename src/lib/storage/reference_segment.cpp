@@ -0,0 +1,169 @@
+#include "reference_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "fixed_size_attribute_vector.hpp"
+#include "pos_list_utils.hpp"
+#include "segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+namespace {
+
+// values are prefetched this many positions before they are gathered
+constexpr auto PREFETCH_DISTANCE = size_t{16};
+
+// Gathers the values at the positions position_index(0), ..., position_index(count - 1), which all lie in the given
+// segment, into the same indices of output.
+template <typename T, typename SegmentType, typename IndexFunctor>
+void gather(const SegmentType& segment, const PosList& pos_list, const size_t count, const IndexFunctor& position_index,
+            std::vector<T>& output) {
+  const auto prefetch = [&](const auto& values, const size_t index) {
+    if (index + PREFETCH_DISTANCE < count) {
+      __builtin_prefetch(&values[pos_list[position_index(index + PREFETCH_DISTANCE)].chunk_offset]);
+    }
+  };
+
+  if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+    const auto values = segment.values();
+    for (auto index = size_t{0}; index < count; ++index) {
+      prefetch(values, index);
+      const auto position = position_index(index);
+      output[position] = values[pos_list[position].chunk_offset];
+    }
+    return;
+  }
+
+  // numeric dictionaries with a fixed-size attribute vector are two plain lookups per position
+  if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>> && !std::is_same_v<T, std::string>) {
+    const auto& dictionary = *segment.dictionary();
+    auto gathered = false;
+    const auto gather_value_ids = [&](const auto* attribute_vector) {
+      if (!attribute_vector) return;
+      const auto& value_ids = attribute_vector->values();
+      for (auto index = size_t{0}; index < count; ++index) {
+        prefetch(value_ids, index);
+        const auto position = position_index(index);
+        output[position] = dictionary[value_ids[pos_list[position].chunk_offset]];
+      }
+      gathered = true;
+    };
+    const auto attribute_vector = segment.attribute_vector().get();
+    gather_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(attribute_vector));
+    gather_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(attribute_vector));
+    gather_value_ids(dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(attribute_vector));
+    if (gathered) return;
+  }
+
+  const auto get_value = detail::make_value_getter<T>(segment);
+  for (auto index = size_t{0}; index < count; ++index) {
+    const auto position = position_index(index);
+    output[position] = get_value(pos_list[position].chunk_offset);
+  }
+}
+
+}  // namespace
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id,
+                                   const std::shared_ptr<const AbstractPosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {
+  DebugAssert(referenced_column_id < referenced_table->column_count(), "Referenced column does not exist");
+}
+
+AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  DebugAssert(chunk_offset < _pos_list->size(), "Position out of range");
+  const auto row_id = _pos_list->get(chunk_offset);
+  const auto chunk = _referenced_table->get_chunk_ptr(row_id.chunk_id);
+  return (*chunk->get_segment(_referenced_column_id))[row_id.chunk_offset];
+}
+
+size_t ReferenceSegment::size() const { return _pos_list->size(); }
+
+const std::shared_ptr<const AbstractPosList> ReferenceSegment::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceSegment::referenced_column_id() const { return _referenced_column_id; }
+
+size_t ReferenceSegment::estimate_memory_usage() const { return _pos_list->memory_usage(); }
+
+template <typename T>
+std::vector<T> ReferenceSegment::materialize() const {
+  auto values = std::vector<T>(_pos_list->size());
+  if (values.empty()) return values;
+
+  const auto resolve_referenced_segment = [&](const ChunkID chunk_id, const auto& functor) {
+    const auto chunk = _referenced_table->get_chunk_ptr(chunk_id);
+    resolve_segment_type<T>(*chunk->get_segment(_referenced_column_id), functor);
+  };
+
+  resolve_pos_list_type(*_pos_list, [&](const auto& typed_pos_list) {
+    using PosListType = std::decay_t<decltype(typed_pos_list)>;
+    if constexpr (std::is_same_v<PosListType, PosList>) {
+      _materialize_pos_list(typed_pos_list, values);
+    } else {
+      // compressed position lists hold sorted positions in a single chunk
+      resolve_referenced_segment(typed_pos_list.chunk_id(), [&](const auto& segment) {
+        const auto get_value = detail::make_value_getter<T>(segment);
+        typed_pos_list.for_each(
+            [&](const size_t index, const RowID& row_id) { values[index] = get_value(row_id.chunk_offset); });
+      });
+    }
+  });
+  return values;
+}
+
+template <typename T>
+void ReferenceSegment::_materialize_pos_list(const PosList& pos_list, std::vector<T>& values) const {
+  const auto gather_chunk = [&](const ChunkID chunk_id, const size_t count, const auto& position_index) {
+    const auto chunk = _referenced_table->get_chunk_ptr(chunk_id);
+    resolve_segment_type<T>(*chunk->get_segment(_referenced_column_id), [&](const auto& segment) {
+      gather<T>(segment, pos_list, count, position_index, values);
+    });
+  };
+
+  if (pos_list.references_single_chunk()) {
+    DebugAssert(std::all_of(pos_list.cbegin(), pos_list.cend(),
+                            [&](const auto& row_id) { return row_id.chunk_id == pos_list.front().chunk_id; }),
+                "Position list references more than one chunk");
+    gather_chunk(pos_list.front().chunk_id, pos_list.size(), [](const size_t index) { return index; });
+    return;
+  }
+
+  // group the positions by chunk with a counting sort, which keeps their order within each chunk
+  const auto chunk_count = _referenced_table->chunk_count();
+  auto group_begins = std::vector<size_t>(chunk_count + 1);
+  for (const auto& row_id : pos_list) ++group_begins[row_id.chunk_id + 1];
+  std::partial_sum(group_begins.cbegin(), group_begins.cend(), group_begins.begin());
+
+  auto grouped_positions = std::vector<uint32_t>(pos_list.size());
+  auto next_slots = group_begins;
+  for (auto position = size_t{0}; position < pos_list.size(); ++position) {
+    grouped_positions[next_slots[pos_list[position].chunk_id]++] = static_cast<uint32_t>(position);
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto group_begin = group_begins[chunk_id];
+    const auto count = group_begins[chunk_id + 1] - group_begin;
+    if (count == 0) continue;
+    gather_chunk(chunk_id, count, [&](const size_t index) { return grouped_positions[group_begin + index]; });
+  }
+}
+
+template std::vector<int32_t> ReferenceSegment::materialize<int32_t>() const;
+template std::vector<int64_t> ReferenceSegment::materialize<int64_t>() const;
+template std::vector<float> ReferenceSegment::materialize<float>() const;
+template std::vector<double> ReferenceSegment::materialize<double>() const;
+template std::vector<std::string> ReferenceSegment::materialize<std::string>() const;
+
+}  // namespace opossum
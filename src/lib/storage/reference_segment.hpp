@@ -22,7 +22,7 @@ class ReferenceSegment : public BaseSegment {
   // creates a reference segment
   // the parameters specify the positions and the referenced segment
   ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
-                   const std::shared_ptr<const PosList> pos);
+                   const std::shared_ptr<const AbstractPosList> pos);
 
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
 
@@ -30,10 +30,29 @@ class ReferenceSegment : public BaseSegment {
 
   size_t size() const override;
 
-  const std::shared_ptr<const PosList> pos_list() const;
+  const std::shared_ptr<const AbstractPosList> pos_list() const;
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
+
+  // Returns the referenced values in the order of the positions. T is the data type of the column. Positions are
+  // grouped by chunk, unless the position list references a single chunk anyway, so that each referenced segment is
+  // resolved only once. Its values are then gathered with typed accesses and prefetched ahead of time. Compressed
+  // position lists are gathered without being expanded to RowIDs.
+  template <typename T>
+  std::vector<T> materialize() const;
+
+  // only the position list is counted, the referenced segments belong to the referenced table
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  // materializes a position list of RowIDs into values, which has the size of the position list
+  template <typename T>
+  void _materialize_pos_list(const PosList& pos_list, std::vector<T>& values) const;
+
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const AbstractPosList> _pos_list;
 };
 
 }  // namespace opossum
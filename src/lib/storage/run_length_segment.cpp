@@ -0,0 +1,82 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _values(std::make_shared<std::vector<T>>()), _end_positions(std::make_shared<std::vector<ChunkOffset>>()) {
+  const auto segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  DebugAssert(segment, "Invalid base segment for run-length segment");
+  const auto& segment_values = segment->values();
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_values.size(); ++chunk_offset) {
+    if (_values->empty() || segment_values[chunk_offset] != _values->back()) {
+      _values->push_back(segment_values[chunk_offset]);
+      _end_positions->push_back(chunk_offset);
+    } else {
+      _end_positions->back() = chunk_offset;
+    }
+  }
+
+  _values->shrink_to_fit();
+  _end_positions->shrink_to_fit();
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  return get(chunk_offset);
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Chunk offset out of range");
+  // the run containing chunk_offset is the first one that ends at or after it
+  const auto run = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset);
+  return (*_values)[std::distance(_end_positions->cbegin(), run)];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant&) {
+  throw std::runtime_error("Tried to call append() on immutable run-length segment");
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<ChunkOffset>> RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_count() const {
+  return _values->size();
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::size() const {
+  return _end_positions->empty() ? 0 : _end_positions->back() + 1;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return _values->size() * sizeof(T) + _end_positions->size() * sizeof(ChunkOffset);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
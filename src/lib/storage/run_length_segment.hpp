@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is a specific segment type that stores each run of consecutive equal values only once, together
+// with the position of the last row of that run. Point access is a binary search over the run ends, while scans and
+// aggregates should iterate over the runs to evaluate a predicate once per run instead of once per row.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  // Creates a run-length encoded segment from a given value segment.
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // run-length segments are immutable
+  void append(const AllTypeVariant&) final;
+
+  // returns the value of each run
+  std::shared_ptr<const std::vector<T>> values() const;
+
+  // returns the position of the last row of each run, i.e., run i spans [end_positions[i - 1] + 1, end_positions[i]]
+  std::shared_ptr<const std::vector<ChunkOffset>> end_positions() const;
+
+  // calls functor(value, begin, end) for each run, where [begin, end) are the chunk offsets of the run's rows
+  template <typename Functor>
+  void for_each_run(const Functor& functor) const {
+    auto begin = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < _values->size(); ++run_index) {
+      const auto end = (*_end_positions)[run_index] + 1;
+      functor((*_values)[run_index], begin, end);
+      begin = end;
+    }
+  }
+
+  // return the number of runs
+  size_t run_count() const;
+
+  // return the number of entries
+  size_t size() const final;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _values;
+  std::shared_ptr<std::vector<ChunkOffset>> _end_positions;
+};
+
+}  // namespace opossum
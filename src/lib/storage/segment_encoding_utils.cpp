@@ -0,0 +1,108 @@
+#include "segment_encoding_utils.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "fsst_segment.hpp"
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+std::string encoding_type_to_string(const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return "Unencoded";
+    case EncodingType::Dictionary:
+      return "Dictionary";
+    case EncodingType::RunLength:
+      return "RunLength";
+    case EncodingType::FrameOfReference:
+      return "FrameOfReference";
+    case EncodingType::FSST:
+      return "FSST";
+    case EncodingType::Reference:
+      return "Reference";
+  }
+  Fail("Unknown encoding type");
+  return "";
+}
+
+bool encoding_supports_data_type(const EncodingType encoding_type, const std::string& column_type) {
+  switch (encoding_type) {
+    case EncodingType::FrameOfReference:
+      return column_type == "int" || column_type == "long";
+    case EncodingType::FSST:
+      return column_type == "string";
+    case EncodingType::Reference:
+      return false;
+    default:
+      return true;
+  }
+}
+
+std::shared_ptr<BaseSegment> encode_segment(const EncodingType encoding_type, const std::string& column_type,
+                                            const std::shared_ptr<BaseSegment>& value_segment) {
+  Assert(encoding_supports_data_type(encoding_type, column_type),
+         encoding_type_to_string(encoding_type) + " encoding does not support data type " + column_type);
+
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return value_segment;
+    case EncodingType::Dictionary:
+      return make_shared_by_data_type<BaseSegment, DictionarySegment>(column_type, value_segment);
+    case EncodingType::RunLength:
+      return make_shared_by_data_type<BaseSegment, RunLengthSegment>(column_type, value_segment);
+    case EncodingType::FrameOfReference: {
+      auto encoded_segment = std::shared_ptr<BaseSegment>{};
+      resolve_data_type(column_type, [&](auto type) {
+        using Type = typename decltype(type)::type;
+        if constexpr (std::is_integral_v<Type>) {
+          encoded_segment = std::make_shared<FrameOfReferenceSegment<Type>>(value_segment);
+        }
+      });
+      return encoded_segment;
+    }
+    case EncodingType::FSST:
+      return std::make_shared<FSSTSegment>(value_segment);
+    case EncodingType::Reference:
+      break;
+  }
+  Fail("Unknown encoding type");
+  return nullptr;
+}
+
+EncodingType get_encoding_type(const std::string& column_type, const std::shared_ptr<const BaseSegment>& segment) {
+  if (std::dynamic_pointer_cast<const ReferenceSegment>(segment)) return EncodingType::Reference;
+
+  auto encoding_type = std::optional<EncodingType>{};
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if (std::dynamic_pointer_cast<const ValueSegment<Type>>(segment)) {
+      encoding_type = EncodingType::Unencoded;
+    } else if (std::dynamic_pointer_cast<const DictionarySegment<Type>>(segment)) {
+      encoding_type = EncodingType::Dictionary;
+    } else if (std::dynamic_pointer_cast<const RunLengthSegment<Type>>(segment)) {
+      encoding_type = EncodingType::RunLength;
+    } else if (std::dynamic_pointer_cast<const FSSTSegment>(segment)) {
+      encoding_type = EncodingType::FSST;
+    }
+
+    if constexpr (std::is_integral_v<Type>) {
+      if (std::dynamic_pointer_cast<const FrameOfReferenceSegment<Type>>(segment)) {
+        encoding_type = EncodingType::FrameOfReference;
+      }
+    }
+  });
+  Assert(encoding_type, "Segment is neither a value segment nor an encoded segment of type " + column_type);
+  return *encoding_type;
+}
+
+}  // namespace opossum
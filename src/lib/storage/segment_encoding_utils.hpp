@@ -0,0 +1,22 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "encoding_type.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// returns whether segments of the given data type can be stored with the given encoding
+bool encoding_supports_data_type(const EncodingType encoding_type, const std::string& column_type);
+
+// Encodes a value segment with the given encoding. For EncodingType::Unencoded, the value segment itself is returned.
+std::shared_ptr<BaseSegment> encode_segment(const EncodingType encoding_type, const std::string& column_type,
+                                            const std::shared_ptr<BaseSegment>& value_segment);
+
+// returns the encoding of a value segment, an encoded segment, or a reference segment
+EncodingType get_encoding_type(const std::string& column_type, const std::shared_ptr<const BaseSegment>& segment);
+
+}  // namespace opossum
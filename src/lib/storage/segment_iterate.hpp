@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "fsst_segment.hpp"
+#include "pos_list_utils.hpp"
+#include "reference_segment.hpp"
+#include "run_length_segment.hpp"
+#include "table.hpp"
+#include "type_cast.hpp"
+#include "value_segment.hpp"
+
+// Typed access to segments of any encoding. Operators resolve the segment type once per segment and then read the
+// values in a loop that neither makes virtual calls nor creates AllTypeVariants:
+//
+//   segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) { ... });
+//
+// resolve_segment_type is the building block for operators that handle some encodings specially, e.g., by working on
+// a dictionary instead of the rows.
+
+namespace opossum {
+
+// Calls functor with the segment cast to its concrete type, e.g., const DictionarySegment<T>&. T is the data type of
+// the segment's column. Segments of other types are passed as const BaseSegment&.
+template <typename T, typename Functor>
+void resolve_segment_type(const BaseSegment& segment, const Functor& functor) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) return functor(*value_segment);
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    return functor(*dictionary_segment);
+  }
+  if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    return functor(*run_length_segment);
+  }
+  if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    return functor(*reference_segment);
+  }
+  if constexpr (std::is_integral_v<T>) {
+    if (const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      return functor(*frame_of_reference_segment);
+    }
+  }
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (const auto fsst_segment = dynamic_cast<const FSSTSegment*>(&segment)) return functor(*fsst_segment);
+  }
+  functor(segment);
+}
+
+namespace detail {
+
+// rows of segments that have to be decoded into a buffer first are decoded this many at a time
+constexpr auto SEGMENT_ITERATE_BLOCK_SIZE = ChunkOffset{2048};
+
+// Returns a functor that returns the value at a chunk offset of a segment whose type has been resolved. Values of
+// ValueSegments are returned by reference.
+template <typename T, typename SegmentType>
+auto make_value_getter(const SegmentType& segment) {
+  if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+    return [values = segment.values()](const ChunkOffset chunk_offset) -> const T& { return values[chunk_offset]; };
+  } else {
+    if constexpr (std::is_same_v<SegmentType, BaseSegment> || std::is_same_v<SegmentType, ReferenceSegment>) {
+      return [&segment](const ChunkOffset chunk_offset) { return type_cast<T>(segment[chunk_offset]); };
+    } else {
+      return [&segment](const ChunkOffset chunk_offset) { return segment.get(chunk_offset); };
+    }
+  }
+}
+
+template <typename T, typename Functor>
+void iterate(const ValueSegment<T>& segment, const Functor& functor) {
+  const auto values = segment.values();
+  const auto size = static_cast<ChunkOffset>(values.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    functor(values[chunk_offset], chunk_offset);
+  }
+}
+
+template <typename T, typename Functor>
+void iterate_dictionary(const DictionarySegment<T>& segment, const std::vector<T>& dictionary, const Functor& functor) {
+  auto value_ids = std::vector<ValueID>{};
+  const auto size = static_cast<ChunkOffset>(segment.size());
+  for (auto begin = ChunkOffset{0}; begin < size; begin += SEGMENT_ITERATE_BLOCK_SIZE) {
+    const auto end = std::min(size, begin + SEGMENT_ITERATE_BLOCK_SIZE);
+    segment.attribute_vector()->decode(begin, end, value_ids);
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      functor(dictionary[value_ids[chunk_offset - begin]], chunk_offset);
+    }
+  }
+}
+
+template <typename T, typename Functor>
+void iterate(const DictionarySegment<T>& segment, const Functor& functor) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // front-coded dictionaries are decoded once, so that each row is a plain lookup
+    auto dictionary = std::vector<std::string>(segment.unique_values_count());
+    segment.dictionary()->for_each([&](const size_t index, const std::string& value) { dictionary[index] = value; });
+    iterate_dictionary(segment, dictionary, functor);
+  } else {
+    iterate_dictionary(segment, *segment.dictionary(), functor);
+  }
+}
+
+template <typename T, typename Functor>
+void iterate(const RunLengthSegment<T>& segment, const Functor& functor) {
+  segment.for_each_run([&](const T& value, const ChunkOffset begin, const ChunkOffset end) {
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) functor(value, chunk_offset);
+  });
+}
+
+// Positions are resolved one run of positions in the same chunk at a time, so that the type of the referenced segment
+// is only resolved when the chunk changes. Use ReferenceSegment::materialize() for positions in random chunk order.
+// Compressed position lists are a single run and are iterated without being expanded to RowIDs.
+template <typename T, typename Functor>
+void iterate(const ReferenceSegment& segment, const Functor& functor) {
+  const auto& referenced_table = *segment.referenced_table();
+  const auto resolve_referenced_segment = [&](const ChunkID chunk_id, const auto& segment_functor) {
+    const auto chunk = referenced_table.get_chunk_ptr(chunk_id);
+    resolve_segment_type<T>(*chunk->get_segment(segment.referenced_column_id()), segment_functor);
+  };
+
+  resolve_pos_list_type(*segment.pos_list(), [&](const auto& pos_list) {
+    const auto position_count = static_cast<ChunkOffset>(pos_list.size());
+    if constexpr (std::is_same_v<std::decay_t<decltype(pos_list)>, PosList>) {
+      auto run_begin = ChunkOffset{0};
+      while (run_begin < position_count) {
+        const auto chunk_id = pos_list[run_begin].chunk_id;
+        auto run_end = pos_list.references_single_chunk() ? position_count : run_begin + 1;
+        while (run_end < position_count && pos_list[run_end].chunk_id == chunk_id) ++run_end;
+
+        resolve_referenced_segment(chunk_id, [&](const auto& referenced_segment) {
+          const auto get_value = make_value_getter<T>(referenced_segment);
+          for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+            functor(get_value(pos_list[chunk_offset].chunk_offset), chunk_offset);
+          }
+        });
+        run_begin = run_end;
+      }
+    } else {
+      if (position_count == 0) return;
+      resolve_referenced_segment(pos_list.chunk_id(), [&](const auto& referenced_segment) {
+        const auto get_value = make_value_getter<T>(referenced_segment);
+        pos_list.for_each([&](const size_t index, const RowID& row_id) {
+          functor(get_value(row_id.chunk_offset), static_cast<ChunkOffset>(index));
+        });
+      });
+    }
+  });
+}
+
+// FrameOfReferenceSegments, FSSTSegments and unknown segment types. There is no overload for
+// FrameOfReferenceSegment<T> because that type must not even be named for non-integral types.
+template <typename T, typename SegmentType, typename Functor>
+void iterate(const SegmentType& segment, const Functor& functor) {
+  if constexpr (std::is_integral_v<T>) {
+    if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
+      auto values = std::vector<T>{};
+      const auto size = static_cast<ChunkOffset>(segment.size());
+      for (auto begin = ChunkOffset{0}; begin < size; begin += FrameOfReferenceSegment<T>::BLOCK_SIZE) {
+        const auto end = std::min(size, begin + FrameOfReferenceSegment<T>::BLOCK_SIZE);
+        segment.decode(begin, end, values);
+        for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+          functor(values[chunk_offset - begin], chunk_offset);
+        }
+      }
+      return;
+    }
+  }
+
+  const auto get_value = make_value_getter<T>(segment);
+  const auto size = static_cast<ChunkOffset>(segment.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    functor(get_value(chunk_offset), chunk_offset);
+  }
+}
+
+}  // namespace detail
+
+// Calls functor(value, chunk_offset) with every row of a segment in order. T is the data type of the segment's column.
+// For ReferenceSegments, chunk_offset is the position in the reference segment, not in the referenced segment.
+template <typename T, typename Functor>
+void segment_iterate(const BaseSegment& segment, const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) { detail::iterate<T>(typed_segment, functor); });
+}
+
+}  // namespace opossum
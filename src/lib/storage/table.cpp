@@ -1,52 +1,175 @@
 #include "table.hpp"
 
+// the linter wants this to be above everything else
+#include <shared_mutex>
+
 #include <algorithm>
+#include <exception>
+#include <functional>
+#include <future>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
-#include <thread>
 #include <utility>
 #include <vector>
 
 #include "value_segment.hpp"
 
-#include "dictionary_segment.hpp"
+#include "base_segment_filter.hpp"
+#include "bloom_filter.hpp"
+#include "encoding_advisor.hpp"
+#include "reference_segment.hpp"
 #include "resolve_type.hpp"
+#include "segment_encoding_utils.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/worker_pool.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
-Table::Table(const uint32_t chunk_size) : _chunk_size(chunk_size) { _add_chunk(); }
+Table::Table(const uint32_t chunk_size) : _chunk_size(chunk_size) { _chunks.push_back(_create_chunk()); }
+
+Table::Table(Table&& other) { *this = std::move(other); }
+
+Table& Table::operator=(Table&& other) {
+  if (&other == this) return *this;
+
+  // moved-from tables have no mutex and nothing pending
+  if (_pending_compressions_mutex) wait_for_compression();
+  if (other._pending_compressions_mutex) other.wait_for_compression();
+
+  _chunk_size = other._chunk_size;
+  _chunks = std::move(other._chunks);
+  _column_names = std::move(other._column_names);
+  _column_types = std::move(other._column_types);
+  _column_encodings = std::move(other._column_encodings);
+  _bloom_filter_columns = std::move(other._bloom_filter_columns);
+  _chunks_mutex = std::move(other._chunks_mutex);
+  _append_mutex = std::move(other._append_mutex);
+  _auto_compression = other._auto_compression.load();
+  _pending_compressions = std::move(other._pending_compressions);
+  _pending_compressions_mutex = std::move(other._pending_compressions_mutex);
+  return *this;
+}
+
+Table::~Table() {
+  // moved-from tables have no mutex and nothing pending
+  if (!_pending_compressions_mutex) return;
+  try {
+    wait_for_compression();
+  } catch (...) {
+    // errors that were not collected through wait_for_compression() are discarded
+  }
+}
 
 void Table::add_column_definition(const std::string& name, const std::string& type) {
-  // Implementation goes here
+  _column_names.push_back(name);
+  _column_types.push_back(type);
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
   Assert(_chunks.front()->size() == 0, "Data is present, cannot add Column");
 
-  _column_names.push_back(name);
-  _column_types.push_back(type);
+  add_column_definition(name, type);
 
   _chunks.front()->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
-  if (_chunks.back()->size() == _chunk_size) {
-    _add_chunk();
-    for (size_t i = 0; i < _column_types.size(); i++) {
-      _chunks.back()->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(_column_types[i]));
+  DebugAssert(values.size() == column_count(), "Number of values does not match the number of columns");
+
+  if (!_presizes_chunks()) {
+    std::lock_guard<std::mutex> lock(*_append_mutex);
+    auto last_chunk = _last_chunk();
+    if (last_chunk.second->size() == _chunk_size || last_chunk.second->is_sealed()) {
+      _add_chunk_after(last_chunk.first);
+      last_chunk = _last_chunk();
+    }
+    last_chunk.second->append(values);
+    if (last_chunk.second->size() == _chunk_size) _finalize_chunk(last_chunk.first, *last_chunk.second);
+    return;
+  }
+
+  // Only the writer that gets no row because the last chunk is full has to wait for the next chunk. If several
+  // writers overflow the chunk at once, one of them adds the next chunk and the others retry on it.
+  while (true) {
+    const auto last_chunk = _last_chunk();
+    const auto chunk_offset = last_chunk.second->try_append(values);
+    if (chunk_offset) {
+      // all rows before this one have been committed, so the chunk is complete
+      if (*chunk_offset + 1 == _chunk_size) _finalize_chunk(last_chunk.first, *last_chunk.second);
+      return;
     }
+    _add_chunk_after(last_chunk.first);
+  }
+}
+
+void Table::append_segments(const std::vector<std::shared_ptr<const BaseValueSegment>>& segments) {
+  Assert(segments.size() == column_count(), "Number of segments does not match the number of columns");
+  const auto row_count = segments.empty() ? size_t{0} : segments.front()->size();
+  for (auto column_id = ColumnID{0}; column_id < column_count(); column_id++) {
+    resolve_data_type(column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      Assert(std::dynamic_pointer_cast<const ValueSegment<Type>>(segments[column_id]),
+             "Segment does not match the type of column " + column_name(column_id));
+    });
+    Assert(segments[column_id]->size() == row_count, "Segments differ in size");
+  }
+
+  auto first_row = size_t{0};
+  if (!_presizes_chunks()) {
+    std::lock_guard<std::mutex> lock(*_append_mutex);
+    while (first_row < row_count) {
+      auto last_chunk = _last_chunk();
+      if (last_chunk.second->size() == _chunk_size || last_chunk.second->is_sealed()) {
+        _add_chunk_after(last_chunk.first);
+        last_chunk = _last_chunk();
+      }
+      const auto free_rows = _chunk_size == 0 ? row_count : size_t{_chunk_size - last_chunk.second->size()};
+      const auto count = std::min(row_count - first_row, free_rows);
+      last_chunk.second->append_segments(segments, first_row, count);
+      first_row += count;
+      if (last_chunk.second->size() == _chunk_size) _finalize_chunk(last_chunk.first, *last_chunk.second);
+    }
+    return;
+  }
+
+  while (first_row < row_count) {
+    const auto last_chunk = _last_chunk();
+    const auto range = last_chunk.second->try_append_segments(segments, first_row, row_count - first_row);
+    if (range) {
+      first_row += range->second;
+      if (range->first + range->second == _chunk_size) _finalize_chunk(last_chunk.first, *last_chunk.second);
+    } else {
+      _add_chunk_after(last_chunk.first);
+    }
+  }
+}
+
+void Table::_finalize_chunk(ChunkID chunk_id, Chunk& chunk) {
+  // The chunk is full and will not change anymore. It is passed in because compress_chunks may already have replaced
+  // it in _chunks.
+  for (auto column_id = ColumnID{0}; column_id < column_count(); column_id++) {
+    chunk.add_segment_filter(column_id, make_shared_by_data_type<BaseSegmentFilter, ZoneMap>(
+                                            column_type(column_id), chunk.get_segment(column_id)));
+  }
+
+  if (_auto_compression) {
+    auto future = WorkerPool::get().schedule([this, chunk_id]() { compress_chunk(chunk_id); });
+    std::lock_guard<std::mutex> lock(*_pending_compressions_mutex);
+    _pending_compressions.push_back(std::move(future));
   }
-  _chunks.back()->append(values);
 }
 
 void Table::create_new_chunk() {
-  // Implementation goes here
+  auto chunk = _create_chunk();
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  _chunks.push_back(std::move(chunk));
 }
 
 uint16_t Table::column_count() const {
@@ -54,9 +177,17 @@ uint16_t Table::column_count() const {
   return _column_names.size();
 }
 
-uint64_t Table::row_count() const { return ((_chunks.size() - 1) * _chunk_size + _chunks.back()->size()); }
+uint64_t Table::row_count() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  // emplaced chunks (e.g., scan results) are not necessarily full, so the chunk sizes have to be summed up
+  return std::accumulate(_chunks.cbegin(), _chunks.cend(), uint64_t{0},
+                         [](const uint64_t sum, const auto& chunk) { return sum + chunk->size(); });
+}
 
-ChunkID Table::chunk_count() const { return ChunkID{static_cast<uint32_t>(_chunks.size())}; }
+ChunkID Table::chunk_count() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return ChunkID{static_cast<uint32_t>(_chunks.size())};
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   // todo : Verify what instrucotr meant with C++20 solution: (unordered_)map::contains
@@ -73,56 +204,251 @@ const std::string& Table::column_name(ColumnID column_id) const { return _column
 
 const std::string& Table::column_type(ColumnID column_id) const { return _column_types.at(column_id); }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) { return *_chunks.at(chunk_id); }
+Chunk& Table::get_chunk(ChunkID chunk_id) {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return *_chunks.at(chunk_id);
+}
 
-const Chunk& Table::get_chunk(ChunkID chunk_id) const { return *_chunks.at(chunk_id); }
+const Chunk& Table::get_chunk(ChunkID chunk_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return *_chunks.at(chunk_id);
+}
+
+std::shared_ptr<const Chunk> Table::get_chunk_ptr(ChunkID chunk_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return _chunks.at(chunk_id);
+}
 
 void Table::emplace_chunk(Chunk chunk) {
-  // todo: This methid does not work as intended it clears out everything instead of emplacing
-  //  find out what happens if the last chunk in the table is non empty
-  // _chunks.clear();
-  // std::shared_ptr<Chunk> new_chunk = std::make_shared<Chunk>(std::move(chunk));
-  // _chunks.push_back(new_chunk);
+  _verify_chunk(chunk);
+  auto new_chunk = std::make_shared<Chunk>(std::move(chunk));
+  new_chunk->seal();
+
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  if (_chunks.size() == 1 && _chunks.front()->size() == 0) {
+    _chunks.front() = std::move(new_chunk);
+  } else {
+    _chunks.push_back(std::move(new_chunk));
+  }
 }
 
-void Table::_add_chunk() { _chunks.push_back(std::make_shared<Chunk>()); }
+void Table::emplace_chunks(std::vector<Chunk> chunks) {
+  if (chunks.empty()) return;
 
-void Table::compress_chunk(ChunkID chunk_id) {
-  // mutex schould be made class variable
-  std::mutex compression_mutex;
-  const auto& uncompressed_chunk = get_chunk(chunk_id);
-  auto number_of_segments = column_count();
-  std::shared_ptr<Chunk> compressed_chunk = std::make_shared<Chunk>();
-  std::vector<std::shared_ptr<BaseSegment>> complete_segments(number_of_segments);
-  std::vector<std::thread> thread_vector(number_of_segments);
+  auto new_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  new_chunks.reserve(chunks.size());
+  for (auto& chunk : chunks) {
+    _verify_chunk(chunk);
+    new_chunks.push_back(std::make_shared<Chunk>(std::move(chunk)));
+    new_chunks.back()->seal();
+  }
 
-  // consider doing this with futures instead but I do not fully comprehend them for now i will need to modify a vector
-  auto compress_segment = [&complete_segments](const ColumnID segment_ID,
-                                               const std::shared_ptr<BaseSegment> value_segment,
-                                               const std::string column_type) {
-    auto dictionary_segment = make_shared_by_data_type<BaseSegment, DictionarySegment>(column_type, value_segment);
-    complete_segments.at(segment_ID) = dictionary_segment;
-  };
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  if (_chunks.size() == 1 && _chunks.front()->size() == 0) _chunks.clear();
+  _chunks.insert(_chunks.end(), std::make_move_iterator(new_chunks.begin()), std::make_move_iterator(new_chunks.end()));
+}
 
-  for (ColumnID segment_ID = ColumnID{0}; segment_ID < number_of_segments; segment_ID++) {
-    std::shared_ptr<BaseSegment> value_segment = uncompressed_chunk.get_segment(segment_ID);
-    thread_vector.at(segment_ID) = std::thread(compress_segment, segment_ID, value_segment, column_type(segment_ID));
+void Table::_verify_chunk(const Chunk& chunk) const {
+  Assert(chunk.column_count() == column_count(), "Chunk has " + std::to_string(chunk.column_count()) +
+                                                     " segments, but the table has " +
+                                                     std::to_string(column_count()) + " columns");
+  for (auto column_id = ColumnID{0}; column_id < column_count(); column_id++) {
+    const auto segment = chunk.get_segment(column_id);
+    Assert(segment->size() == chunk.size(), "Segments of the chunk differ in size");
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      const auto& referenced_type =
+          reference_segment->referenced_table()->column_type(reference_segment->referenced_column_id());
+      Assert(referenced_type == column_type(column_id),
+             "Segment references a column of type " + referenced_type + ", expected " + column_type(column_id));
+    } else {
+      // fails for segments of another data type
+      get_encoding_type(column_type(column_id), segment);
+    }
   }
+}
 
-  for (auto thread_id = ColumnID{0}; thread_id < thread_vector.size(); thread_id++) {
-    thread_vector.at(thread_id).join();
+std::shared_ptr<Chunk> Table::_create_chunk() const {
+  auto chunk = std::make_shared<Chunk>();
+  for (const auto& type : _column_types) {
+    chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
   }
+  if (_presizes_chunks()) chunk->presize(_chunk_size);
+  return chunk;
+}
+
+void Table::_add_chunk_after(ChunkID last_chunk_id) {
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  // another writer that overflowed the same chunk was faster
+  if (_chunks.size() != last_chunk_id + size_t{1}) return;
+  _chunks.push_back(_create_chunk());
+}
+
+bool Table::_presizes_chunks() const { return _chunk_size > 0 && _chunk_size <= MAX_PRESIZED_CHUNK_SIZE; }
+
+std::pair<ChunkID, std::shared_ptr<Chunk>> Table::_last_chunk() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return {ChunkID{static_cast<uint32_t>(_chunks.size() - 1)}, _chunks.back()};
+}
+
+std::vector<std::shared_ptr<const BaseSegmentFilter>> Table::_build_segment_filters(
+    const ColumnID column_id, const std::shared_ptr<BaseSegment>& value_segment,
+    const std::shared_ptr<BaseSegment>& encoded_segment) const {
+  auto filters = std::vector<std::shared_ptr<const BaseSegmentFilter>>{};
+  if (value_segment->size() == 0) return filters;
+
+  const auto& type = column_type(column_id);
+  filters.push_back(make_shared_by_data_type<BaseSegmentFilter, ZoneMap>(type, value_segment));
+
+  if (has_bloom_filter(column_id)) {
+    // a dictionary already holds the distinct values, so the filter is built from it instead of from all rows
+    const auto& source_segment =
+        get_encoding_type(type, encoded_segment) == EncodingType::Dictionary ? encoded_segment : value_segment;
+    filters.push_back(make_shared_by_data_type<BaseSegmentFilter, BloomFilter>(type, source_segment));
+  }
+  return filters;
+}
+
+void Table::compress_chunk(ChunkID chunk_id) { compress_chunks(chunk_id, ChunkID{chunk_id + 1}); }
+
+void Table::compress_all_chunks() { compress_chunks(ChunkID{0}, chunk_count()); }
+
+void Table::compress_chunks(const ChunkID begin, const ChunkID end) {
+  Assert(begin <= end && end <= chunk_count(), "Invalid chunk range");
+
+  // Chunks that have been compressed before are skipped, as are emplaced chunks that do not consist of ValueSegments:
+  // their segments are encoded already or, for reference segments (e.g., scan results), hold values of another table.
+  // Holding the value chunks keeps them alive while they are compressed, even if they are replaced concurrently.
+  auto value_chunks = std::vector<std::pair<ChunkID, std::shared_ptr<const Chunk>>>{};
+  {
+    // Rows appended to a chunk after it has been read would be lost when it is replaced, so each chunk is sealed
+    // first and subsequent appends go to a new chunk. The append mutex serializes this with appends to chunks that
+    // are not pre-sized and with other compressions.
+    std::lock_guard<std::mutex> append_lock(*_append_mutex);
+    for (auto chunk_id = begin; chunk_id < end; chunk_id++) {
+      auto chunk = std::shared_ptr<Chunk>{};
+      {
+        std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+        chunk = _chunks.at(chunk_id);
+      }
+      if (chunk->is_compressed()) continue;
+      auto has_value_segments = true;
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); column_id++) {
+        has_value_segments &= get_encoding_type(column_type(column_id), chunk->get_segment(column_id)) ==
+                              EncodingType::Unencoded;
+      }
+      if (!has_value_segments) continue;
+      chunk->seal();
+      value_chunks.emplace_back(chunk_id, std::move(chunk));
+    }
+  }
+
+  // One task per segment, so that tables with few chunks but many columns are parallelized just as well as tables
+  // with many chunks and few columns.
+  const auto number_of_columns = column_count();
+  auto encoded_segments = std::vector<std::shared_ptr<BaseSegment>>(value_chunks.size() * number_of_columns);
+  auto segment_filters =
+      std::vector<std::vector<std::shared_ptr<const BaseSegmentFilter>>>(value_chunks.size() * number_of_columns);
+  auto tasks = std::vector<std::function<void()>>{};
+  tasks.reserve(encoded_segments.size());
+  for (auto chunk_index = size_t{0}; chunk_index < value_chunks.size(); chunk_index++) {
+    for (auto column_id = ColumnID{0}; column_id < number_of_columns; column_id++) {
+      tasks.emplace_back([&, chunk_index, column_id]() {
+        const auto segment_index = chunk_index * number_of_columns + column_id;
+        const auto value_segment = value_chunks[chunk_index].second->get_segment(column_id);
+        const auto& type = column_type(column_id);
+        const auto pinned_encoding = column_encoding(column_id);
+        const auto encoding_type =
+            pinned_encoding ? *pinned_encoding : EncodingAdvisor::choose_encoding(type, value_segment);
+
+        encoded_segments[segment_index] = encode_segment(encoding_type, type, value_segment);
+        segment_filters[segment_index] =
+            _build_segment_filters(column_id, value_segment, encoded_segments[segment_index]);
+      });
+    }
+  }
+  WorkerPool::get().execute_and_wait(std::move(tasks));
 
-  for (auto compressed_id = ColumnID{0}; compressed_id < complete_segments.size(); compressed_id++) {
-    compressed_chunk->add_segment(complete_segments[compressed_id]);
+  auto compressed_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto chunk_index = size_t{0}; chunk_index < value_chunks.size(); chunk_index++) {
+    auto compressed_chunk = std::make_shared<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < number_of_columns; column_id++) {
+      const auto segment_index = chunk_index * number_of_columns + column_id;
+      compressed_chunk->add_segment(encoded_segments[segment_index]);
+      for (const auto& filter : segment_filters[segment_index]) compressed_chunk->add_segment_filter(column_id, filter);
+    }
+    compressed_chunk->seal();
+    compressed_chunk->mark_compressed();
+    compressed_chunks.push_back(std::move(compressed_chunk));
   }
 
-  std::lock_guard<std::mutex>lock(compression_mutex);
-  _chunks[chunk_id] = compressed_chunk;
+  // Readers that obtained the old chunks through get_chunk_ptr keep them alive until they are done
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  for (auto chunk_index = size_t{0}; chunk_index < value_chunks.size(); chunk_index++) {
+    _chunks[value_chunks[chunk_index].first] = compressed_chunks[chunk_index];
+  }
 }
 
-void emplace_chunk(Chunk chunk) {
-  // Implementation goes here
+void Table::set_auto_compression(bool enabled) { _auto_compression = enabled; }
+
+bool Table::auto_compression() const { return _auto_compression; }
+
+void Table::wait_for_compression() {
+  auto pending_compressions = std::vector<std::future<void>>{};
+  {
+    std::lock_guard<std::mutex> lock(*_pending_compressions_mutex);
+    pending_compressions.swap(_pending_compressions);
+  }
+
+  // Wait for all compressions before rethrowing, so that none of them is still running afterwards. Waiting through the
+  // pool runs queued tasks meanwhile, so a task of the pool can wait without blocking the compressions it waits for.
+  auto error = std::exception_ptr{};
+  for (auto& compression : pending_compressions) {
+    try {
+      WorkerPool::get().wait(compression);
+      compression.get();
+    } catch (...) {
+      if (!error) error = std::current_exception();
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+void Table::set_column_encoding(ColumnID column_id, EncodingType encoding_type) {
+  Assert(encoding_supports_data_type(encoding_type, column_type(column_id)),
+         encoding_type_to_string(encoding_type) + " encoding does not support column type " + column_type(column_id));
+  _column_encodings[column_id] = encoding_type;
+}
+
+void Table::reset_column_encoding(ColumnID column_id) { _column_encodings.erase(column_id); }
+
+std::optional<EncodingType> Table::column_encoding(ColumnID column_id) const {
+  const auto iter = _column_encodings.find(column_id);
+  if (iter == _column_encodings.end()) return std::nullopt;
+  return iter->second;
+}
+
+void Table::set_bloom_filter(ColumnID column_id, bool enabled) {
+  Assert(column_id < column_count(), "Column does not exist");
+  if (enabled) {
+    _bloom_filter_columns.insert(column_id);
+  } else {
+    _bloom_filter_columns.erase(column_id);
+  }
+}
+
+bool Table::has_bloom_filter(ColumnID column_id) const { return _bloom_filter_columns.count(column_id) > 0; }
+
+std::vector<SegmentEncodingInfo> Table::segment_encodings() const {
+  auto segment_encodings = std::vector<SegmentEncodingInfo>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); chunk_id++) {
+    const auto chunk = get_chunk_ptr(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); column_id++) {
+      const auto segment = chunk->get_segment(column_id);
+      segment_encodings.push_back({chunk_id, column_id, get_encoding_type(column_type(column_id), segment),
+                                   segment->estimate_memory_usage()});
+    }
+  }
+  return segment_encodings;
 }
 
 }  // namespace opossum
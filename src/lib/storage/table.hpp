@@ -1,15 +1,25 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <shared_mutex>
+
+#include <atomic>
 #include <limits>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "base_segment_filter.hpp"
+#include "base_value_segment.hpp"
 #include "chunk.hpp"
+#include "encoding_type.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -22,15 +32,23 @@ class TableStatistics;
 // A table is partitioned horizontally into a number of chunks
 class Table : private Noncopyable {
  public:
+  // The largest chunks that append() fills without a lock. Their segments start small and double as rows arrive (see
+  // Chunk::presize), so a table with few rows does not allocate a whole chunk.
+  static constexpr auto MAX_PRESIZED_CHUNK_SIZE = uint32_t{1'000'000};
+
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
   // default is the maximum chunk size minus 1. A table holds always at least one chunk
   explicit Table(const uint32_t chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
 
-  // we need to explicitly set the move constructor to default when
-  // we overwrite the copy constructor
-  Table(Table&&) = default;
-  Table& operator=(Table&&) = default;
+  // Pending background compressions reference the table they were scheduled for, so moving waits for them first and
+  // rethrows their first error, if any. The table must not be appended to while it is moved.
+  Table(Table&& other);
+  Table& operator=(Table&& other);
+
+  // Waits for pending background compressions, as they reference the table. Errors of compressions that were not
+  // collected through wait_for_compression() are discarded.
+  ~Table();
 
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t column_count() const;
@@ -43,13 +61,24 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // returns the chunk with the given id
+  // Returns the chunk with the given id. The reference becomes invalid when compress_chunks() replaces the chunk, so
+  // use get_chunk_ptr() if that can happen concurrently. This includes tables with background compression enabled,
+  // which replaces chunks at any time.
   Chunk& get_chunk(ChunkID chunk_id);
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
-  // Adds a chunk to the table. If the first chunk is empty, it is replaced.
+  // returns the chunk with the given id, which stays valid even if the table replaces it in the meantime
+  std::shared_ptr<const Chunk> get_chunk_ptr(ChunkID chunk_id) const;
+
+  // Adds a chunk to the table, e.g., the output of an operator. Its segments are moved in, not copied. The chunk needs
+  // one segment of the column's type per column, reference segments have to reference a column of that type. If the
+  // table consists of a single empty chunk, that chunk is replaced. The chunk is sealed, so rows appended afterwards go
+  // to a new chunk instead of the moved-in segments.
   void emplace_chunk(Chunk chunk);
 
+  // adds many chunks like emplace_chunk, but takes the chunk lock only once
+  void emplace_chunks(std::vector<Chunk> chunks);
+
   // Returns a list of all column names.
   const std::vector<std::string>& column_names() const;
 
@@ -77,24 +106,104 @@ class Table : private Noncopyable {
   // with default values
   void add_column(const std::string& name, const std::string& type);
 
-  // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // Inserts a row at the end of the table. It is safe to call concurrently with other appends and with readers, which
+  // see only rows that have been committed. As long as max_chunk_size() does not exceed MAX_PRESIZED_CHUNK_SIZE,
+  // writers reserve rows in the last chunk without blocking each other. Larger chunks, including those of a
+  // default-constructed table, cannot be pre-allocated: appends to them are serialized and grow their ValueSegments.
   void append(std::vector<AllTypeVariant> values);
 
-  // creates a new chunk and appends it
+  // Appends rows that are given column by column, e.g., by a bulk loader that has parsed one vector per column into
+  // a ValueSegment. There is one segment per column, of the column's data type, and all segments have the same size.
+  // The rows are copied range by range into the table's chunks without an AllTypeVariant per value. It is as safe to
+  // call concurrently as append().
+  void append_segments(const std::vector<std::shared_ptr<const BaseValueSegment>>& segments);
+
+  // appends a new chunk of empty ValueSegments, which subsequent appends fill
   void create_new_chunk();
 
-  // compresses a ValueSegment into a DictionarySegment
+  // Compresses the ValueSegments of a chunk. Each segment is encoded with the encoding pinned for its column or, if
+  // there is none, with the encoding the EncodingAdvisor estimates to be the smallest.
   void compress_chunk(ChunkID chunk_id);
 
+  // Compresses the chunks in [begin, end) like compress_chunk. All segments are encoded in parallel on the
+  // WorkerPool. Chunks that have already been compressed are skipped. The other chunks are sealed first, so that rows
+  // appended concurrently go to a new chunk instead of being lost. The compressed chunks replace the old chunks,
+  // which stay valid for readers that hold them through get_chunk_ptr().
+  void compress_chunks(const ChunkID begin, const ChunkID end);
+
+  // compresses all chunks of the table, e.g., after a bulk load
+  void compress_all_chunks();
+
+  // Enables or disables background compression. When enabled, each chunk that append() fills up to max_chunk_size()
+  // is compressed asynchronously on the WorkerPool and then replaces the uncompressed chunk. The table must not be
+  // moved while compressions are pending.
+  void set_auto_compression(bool enabled);
+  bool auto_compression() const;
+
+  // Blocks until all background compressions scheduled so far have finished and rethrows the first error, if any. The
+  // waiting thread runs queued tasks of the WorkerPool meanwhile, so this may be called from a task of the pool.
+  void wait_for_compression();
+
+  // pins a column to an encoding, which is then used by compress_chunk instead of asking the EncodingAdvisor
+  void set_column_encoding(ColumnID column_id, EncodingType encoding_type);
+
+  // removes a pinned encoding, letting the EncodingAdvisor choose again
+  void reset_column_encoding(ColumnID column_id);
+
+  // returns the encoding pinned for a column, if any
+  std::optional<EncodingType> column_encoding(ColumnID column_id) const;
+
+  // Enables or disables Bloom filters for a column. When enabled, compress_chunk adds a Bloom filter to the column's
+  // segment, which lets equality scans skip chunks that do not contain the search value.
+  void set_bloom_filter(ColumnID column_id, bool enabled);
+
+  // returns whether compress_chunk adds Bloom filters to the column
+  bool has_bloom_filter(ColumnID column_id) const;
+
+  // returns the encoding and memory usage of every segment, ordered by chunk and column
+  std::vector<SegmentEncodingInfo> segment_encodings() const;
+
  protected:
   // Implementation goes here
   uint32_t _chunk_size;
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
+  std::map<ColumnID, EncodingType> _column_encodings;
+  std::set<ColumnID> _bloom_filter_columns;
+
+  // Protects _chunks against concurrent replacement and growth. It is held by a unique_ptr to keep tables movable.
+  std::unique_ptr<std::shared_mutex> _chunks_mutex = std::make_unique<std::shared_mutex>();
+
+  // serializes appends to tables whose chunks are not pre-sized
+  std::unique_ptr<std::mutex> _append_mutex = std::make_unique<std::mutex>();
+
+  std::atomic<bool> _auto_compression{false};
+  std::vector<std::future<void>> _pending_compressions;
+  std::unique_ptr<std::mutex> _pending_compressions_mutex = std::make_unique<std::mutex>();
 
  private:
-  void _add_chunk();
+  // creates a chunk of empty ValueSegments, pre-sized if the chunk size allows
+  std::shared_ptr<Chunk> _create_chunk() const;
+
+  // returns whether chunks are small enough to be allocated up front
+  bool _presizes_chunks() const;
+
+  // checks that a chunk to be emplaced matches the columns of the table
+  void _verify_chunk(const Chunk& chunk) const;
+
+  // appends a chunk unless the table has more chunks than last_chunk_id + 1 already
+  void _add_chunk_after(ChunkID last_chunk_id);
+
+  // returns the id of the last chunk together with the chunk
+  std::pair<ChunkID, std::shared_ptr<Chunk>> _last_chunk() const;
+
+  // adds zone maps to a chunk that append() has filled and schedules its compression if enabled
+  void _finalize_chunk(ChunkID chunk_id, Chunk& chunk);
+
+  // builds the zone map and, if enabled for the column, the Bloom filter of a segment that is being compressed
+  std::vector<std::shared_ptr<const BaseSegmentFilter>> _build_segment_filters(
+      const ColumnID column_id, const std::shared_ptr<BaseSegment>& value_segment,
+      const std::shared_ptr<BaseSegment>& encoded_segment) const;
 };
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -13,31 +14,100 @@
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T>&& values)
+    : _values(std::make_shared<std::vector<T>>(std::move(values))), _size(_values->size()) {}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
 
-  return _values.at(chunk_offset);
+  const auto values = this->values();
+  Assert(chunk_offset < values.size(), "ChunkOffset out of range");
+  return values[chunk_offset];
 }
 
 template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& val) {
-  _values.push_back(type_cast<T>(val));
+  const auto size = _size.load(std::memory_order_relaxed);
+  _reserve(size + 1)[size] = type_cast<T>(val);
+  _size.store(size + 1, std::memory_order_release);
 }
 
 template <typename T>
 size_t ValueSegment<T>::size() const {
-  return _values.size();
+  return _size.load(std::memory_order_acquire);
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
-  return _values;
+ValueSpan<T> ValueSegment<T>::values() const {
+  // the buffer is replaced before the size grows beyond it, so the buffer loaded afterwards holds all visible rows
+  const auto size = this->size();
+  auto buffer = std::shared_ptr<const std::vector<T>>{std::atomic_load(&_values)};
+  const auto* const data = buffer->data();
+  return ValueSpan<T>{data, size, std::move(buffer)};
 }
 
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
-  return _values.size() * sizeof(T);
+  return std::atomic_load(&_values)->size() * sizeof(T);
+}
+
+template <typename T>
+void ValueSegment<T>::presize(size_t capacity) {
+  _reserve(capacity);
+}
+
+template <typename T>
+AllTypeVariant ValueSegment<T>::convert(const AllTypeVariant& value) const {
+  return type_cast<T>(value);
+}
+
+template <typename T>
+void ValueSegment<T>::write(const ChunkOffset chunk_offset, AllTypeVariant&& value) {
+  DebugAssert(chunk_offset < _values->size(), "Row has not been allocated");
+  (*_values)[chunk_offset] = std::move(boost::get<T>(value));
+}
+
+template <typename T>
+void ValueSegment<T>::commit(size_t size) {
+  DebugAssert(size <= _values->size(), "Cannot commit rows that have not been allocated");
+  _size.store(size, std::memory_order_release);
+}
+
+template <typename T>
+void ValueSegment<T>::append_values(const BaseValueSegment& source, size_t first_row, size_t count) {
+  DebugAssert(dynamic_cast<const ValueSegment<T>*>(&source), "Source segment has a different data type");
+  const auto source_values = static_cast<const ValueSegment<T>&>(source).values();
+  DebugAssert(first_row + count <= source_values.size(), "Source rows out of range");
+
+  const auto size = _size.load(std::memory_order_relaxed);
+  auto& values = _reserve(size + count);
+  std::copy_n(source_values.cbegin() + first_row, count, values.begin() + size);
+  _size.store(size + count, std::memory_order_release);
+}
+
+template <typename T>
+void ValueSegment<T>::write_values(const ChunkOffset chunk_offset, const BaseValueSegment& source, size_t first_row,
+                                   size_t count) {
+  DebugAssert(dynamic_cast<const ValueSegment<T>*>(&source), "Source segment has a different data type");
+  const auto source_values = static_cast<const ValueSegment<T>&>(source).values();
+  DebugAssert(first_row + count <= source_values.size(), "Source rows out of range");
+  DebugAssert(chunk_offset + count <= _values->size(), "Rows have not been allocated");
+  std::copy_n(source_values.cbegin() + first_row, count, _values->begin() + chunk_offset);
+}
+
+template <typename T>
+std::vector<T>& ValueSegment<T>::_reserve(size_t capacity) {
+  if (capacity <= _values->size()) return *_values;
+
+  // Readers may still use the current buffer, so it is copied instead of resized. Doubling keeps appends amortized
+  // constant.
+  const auto size = _size.load(std::memory_order_relaxed);
+  auto buffer = std::make_shared<std::vector<T>>(std::max(capacity, _values->size() * 2));
+  std::copy_n(_values->cbegin(), size, buffer->begin());
+  std::atomic_store(&_values, buffer);
+  return *buffer;
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueSegment);
@@ -1,22 +1,58 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "base_segment.hpp"
+#include "base_value_segment.hpp"
 
 namespace opossum {
 
+// A read-only view of the values of a ValueSegment that are visible to readers. It can be used like a
+// const std::vector<T>&. It keeps the buffer that holds the values alive, so it stays valid while the segment grows.
+template <typename T>
+class ValueSpan {
+ public:
+  using value_type = T;
+  using const_iterator = const T*;
+
+  ValueSpan(const T* data, const size_t size, std::shared_ptr<const std::vector<T>> buffer = nullptr)
+      : _data(data), _size(size), _buffer(std::move(buffer)) {}
+
+  const T* data() const { return _data; }
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  const T& operator[](const size_t index) const { return _data[index]; }
+
+  const_iterator begin() const { return _data; }
+  const_iterator end() const { return _data + _size; }
+  const_iterator cbegin() const { return _data; }
+  const_iterator cend() const { return _data + _size; }
+
+ protected:
+  const T* _data;
+  size_t _size;
+  std::shared_ptr<const std::vector<T>> _buffer;
+};
+
 // ValueSegment is a segment type that stores all its values in a vector
 template <typename T>
-class ValueSegment : public BaseSegment {
+class ValueSegment : public BaseValueSegment {
  public:
+  ValueSegment() = default;
+
+  // takes over the given values without copying them, e.g., a column that a bulk loader has parsed
+  explicit ValueSegment(std::vector<T>&& values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
-  // add a value to the end
+  // Adds a value to the end. If the buffer is full, the values are copied into a buffer twice as large, which then
+  // replaces it. ValueSpans returned by values() keep the old buffer. It is safe to call concurrently with readers,
+  // but not with other writers.
   void append(const AllTypeVariant& val) final;
 
   // return the number of entries
@@ -25,14 +61,35 @@ class ValueSegment : public BaseSegment {
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  // Rows committed after this call are not part of the returned values.
+  ValueSpan<T> values() const;
 
-  // returns the calculated memory usage
+  // returns the calculated memory usage, which includes rows that have been allocated but not appended yet
   size_t estimate_memory_usage() const final;
 
+  void presize(size_t capacity) final;
+
+  AllTypeVariant convert(const AllTypeVariant& value) const final;
+
+  void write(const ChunkOffset chunk_offset, AllTypeVariant&& value) final;
+
+  void commit(size_t size) final;
+
+  void append_values(const BaseValueSegment& source, size_t first_row, size_t count) final;
+
+  void write_values(const ChunkOffset chunk_offset, const BaseValueSegment& source, size_t first_row,
+                    size_t count) final;
+
  protected:
   // Implementation goes here
-  std::vector<T> _values;
+  // The buffer may hold more (pre-allocated) rows than the segment, only the first _size of them are visible. Growing
+  // replaces it through std::atomic_store, readers take it with std::atomic_load after they have read _size.
+  std::shared_ptr<std::vector<T>> _values = std::make_shared<std::vector<T>>();
+  std::atomic<size_t> _size{0};
+
+ private:
+  // makes room for at least capacity rows, replacing the buffer if it is too small
+  std::vector<T>& _reserve(size_t capacity);
 };
 
 }  // namespace opossum
@@ -0,0 +1,75 @@
+#include "zone_map.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+ZoneMap<T>::ZoneMap(const std::shared_ptr<const BaseSegment>& value_segment) {
+  const auto typed_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(value_segment);
+  Assert(typed_segment, "Zone maps can only be built from value segments");
+
+  const auto& values = typed_segment->values();
+  Assert(!values.empty(), "Zone maps cannot be built for empty segments");
+
+  const auto minmax = std::minmax_element(values.cbegin(), values.cend());
+  _min = *minmax.first;
+  _max = *minmax.second;
+}
+
+template <typename T>
+ZoneMap<T>::ZoneMap(const T& min, const T& max) : _min(min), _max(max) {
+  DebugAssert(!(max < min), "Minimum of a zone map must not exceed its maximum");
+}
+
+template <typename T>
+bool ZoneMap<T>::can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto value = type_cast<T>(search_value);
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return value < _min || _max < value;
+    case ScanType::OpNotEquals:
+      return _min == value && _max == value;
+    case ScanType::OpLessThan:
+      return !(_min < value);
+    case ScanType::OpLessThanEquals:
+      return value < _min;
+    case ScanType::OpGreaterThan:
+      return !(value < _max);
+    case ScanType::OpGreaterThanEquals:
+      return _max < value;
+  }
+  Fail("Unknown scan type");
+  return false;
+}
+
+template <typename T>
+const T& ZoneMap<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const T& ZoneMap<T>::max() const {
+  return _max;
+}
+
+template <typename T>
+size_t ZoneMap<T>::estimate_memory_usage() const {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return 2 * sizeof(T) + _min.capacity() + _max.capacity();
+  } else {
+    return 2 * sizeof(T);
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
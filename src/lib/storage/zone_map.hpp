@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+
+#include "base_segment_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// A ZoneMap stores the minimum and the maximum of a segment. On sorted or clustered columns (e.g., timestamps of
+// time-ordered tables), this lets range and equality scans skip all chunks outside of the searched range.
+template <typename T>
+class ZoneMap : public BaseSegmentFilter {
+ public:
+  // creates a zone map from a non-empty value segment
+  explicit ZoneMap(const std::shared_ptr<const BaseSegment>& value_segment);
+
+  ZoneMap(const T& min, const T& max);
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  const T& min() const;
+  const T& max() const;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  T _min;
+  T _max;
+};
+
+}  // namespace opossum
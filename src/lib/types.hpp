@@ -5,6 +5,7 @@
 #include <limits>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "strong_typedef.hpp"
@@ -53,7 +54,74 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
-using PosList = std::vector<RowID>;
+// Interface of the position list representations. Besides PosList, a plain vector of RowIDs, there are compressed
+// representations of sorted positions in a single chunk (see storage/pos_list_utils.hpp). Operators should resolve the
+// representation with resolve_pos_list_type and iterate the typed list instead of calling get() for every position.
+class AbstractPosList {
+ public:
+  virtual ~AbstractPosList() = default;
+
+  virtual size_t size() const = 0;
+
+  // returns the position at index, which may require a search in compressed representations
+  virtual RowID get(const size_t index) const = 0;
+
+  // returns whether all positions are known to reference the same chunk
+  virtual bool references_single_chunk() const = 0;
+
+  virtual size_t memory_usage() const = 0;
+};
+
+// A list of positions, e.g., the rows a scan matched. A producer that knows that all positions lie in the same chunk
+// can guarantee it, so that consumers resolve that chunk once instead of looking at every position. The vector is
+// only exposed read-only, and adding positions revokes the guarantee, so it cannot outlive the positions it covers.
+class PosList final : public AbstractPosList, private std::vector<RowID> {
+ public:
+  using std::vector<RowID>::vector;
+
+  // takes over the positions without copying them
+  explicit PosList(std::vector<RowID>&& row_ids) : std::vector<RowID>(std::move(row_ids)) {}
+
+  using value_type = RowID;
+  using const_iterator = std::vector<RowID>::const_iterator;
+
+  size_t size() const final { return std::vector<RowID>::size(); }
+  bool empty() const { return std::vector<RowID>::empty(); }
+
+  RowID get(const size_t index) const final { return (*this)[index]; }
+
+  const RowID& operator[](const size_t index) const { return std::vector<RowID>::operator[](index); }
+  const RowID& front() const { return std::vector<RowID>::front(); }
+  const RowID& back() const { return std::vector<RowID>::back(); }
+
+  const_iterator begin() const { return std::vector<RowID>::cbegin(); }
+  const_iterator end() const { return std::vector<RowID>::cend(); }
+  const_iterator cbegin() const { return std::vector<RowID>::cbegin(); }
+  const_iterator cend() const { return std::vector<RowID>::cend(); }
+
+  void reserve(const size_t capacity) { std::vector<RowID>::reserve(capacity); }
+
+  void push_back(const RowID& row_id) {
+    _references_single_chunk = false;
+    std::vector<RowID>::push_back(row_id);
+  }
+
+  // must be called after the last position has been added
+  void guarantee_single_chunk() { _references_single_chunk = true; }
+
+  bool references_single_chunk() const final { return _references_single_chunk; }
+
+  size_t memory_usage() const final { return size() * sizeof(RowID); }
+
+  // calls functor(index, row_id) for every position
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    for (auto index = size_t{0}; index < size(); ++index) functor(index, (*this)[index]);
+  }
+
+ protected:
+  bool _references_single_chunk = false;
+};
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
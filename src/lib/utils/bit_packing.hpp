@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * Helpers for storing unsigned integers of a fixed bit width back to back in 64-bit words, as used by the
+ * BitPackedAttributeVector and the FrameOfReferenceSegment. Values may straddle two words. Every packed buffer ends
+ * with one padding word so that reading a value never needs to check whether it continues in the next word.
+ */
+
+namespace opossum {
+
+constexpr auto BITS_PER_WORD = size_t{64};
+
+// returns a mask with the lowest bit_width bits set (bit_width <= 64)
+inline uint64_t packed_bit_mask(const uint8_t bit_width) {
+  return bit_width == 0 ? 0 : std::numeric_limits<uint64_t>::max() >> (BITS_PER_WORD - bit_width);
+}
+
+// returns the number of words (including the padding word) needed to store count values of bit_width bits
+inline size_t packed_word_count(const size_t count, const uint8_t bit_width) {
+  return (count * bit_width + BITS_PER_WORD - 1) / BITS_PER_WORD + 1;
+}
+
+// returns the number of bits needed to represent max_value
+inline uint8_t packed_bit_width(const uint64_t max_value) {
+  auto bit_width = uint8_t{0};
+  while (bit_width < BITS_PER_WORD && (max_value >> bit_width) != 0) {
+    ++bit_width;
+  }
+  return bit_width;
+}
+
+// Reads the value starting at bit_position. Shifting by (BITS_PER_WORD - 1 - bit_offset) and then by one avoids
+// undefined behavior for bit_offset == 0.
+inline uint64_t read_packed_bits(const uint64_t* words, const size_t bit_position, const uint64_t mask) {
+  const auto word_index = bit_position / BITS_PER_WORD;
+  const auto bit_offset = bit_position % BITS_PER_WORD;
+  const auto low = words[word_index] >> bit_offset;
+  const auto high = (words[word_index + 1] << (BITS_PER_WORD - 1 - bit_offset)) << 1;
+  return (low | high) & mask;
+}
+
+// Overwrites the value starting at bit_position. value must fit into bit_width bits.
+inline void write_packed_bits(uint64_t* words, const size_t bit_position, const uint8_t bit_width,
+                              const uint64_t value) {
+  if (bit_width == 0) return;
+
+  const auto mask = packed_bit_mask(bit_width);
+  const auto word_index = bit_position / BITS_PER_WORD;
+  const auto bit_offset = bit_position % BITS_PER_WORD;
+
+  words[word_index] = (words[word_index] & ~(mask << bit_offset)) | (value << bit_offset);
+  if (bit_offset + bit_width > BITS_PER_WORD) {
+    const auto written_bits = BITS_PER_WORD - bit_offset;
+    words[word_index + 1] = (words[word_index + 1] & ~(mask >> written_bits)) | (value >> written_bits);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "utils/worker_pool.hpp"
+
+namespace opossum {
+
+// Sorts [begin, end) in up to part_count parts on the WorkerPool. The range is split into equally sized parts that
+// are sorted concurrently and then merged pairwise, again concurrently, until a single sorted run remains. Only worth
+// it for large ranges, as every merge round touches all elements once more. By default, there is one part per worker
+// and one for the calling thread, which executes tasks while it waits for them.
+template <typename RandomIt, typename Compare>
+void parallel_sort(RandomIt begin, RandomIt end, Compare compare,
+                   size_t part_count = WorkerPool::get().worker_count() + 1) {
+  const auto size = static_cast<size_t>(std::distance(begin, end));
+  part_count = std::min(part_count, size);
+  if (part_count <= 1) {
+    std::sort(begin, end, compare);
+    return;
+  }
+
+  // part i covers [bounds[i], bounds[i + 1])
+  auto bounds = std::vector<RandomIt>{};
+  for (auto part = size_t{0}; part <= part_count; ++part) bounds.push_back(begin + part * size / part_count);
+
+  auto& worker_pool = WorkerPool::get();
+  auto tasks = std::vector<std::function<void()>>{};
+  for (auto part = size_t{0}; part < part_count; ++part) {
+    tasks.emplace_back([&, part]() { std::sort(bounds[part], bounds[part + 1], compare); });
+  }
+  worker_pool.execute_and_wait(std::move(tasks));
+
+  while (bounds.size() > 2) {
+    tasks = std::vector<std::function<void()>>{};
+    auto merged_bounds = std::vector<RandomIt>{};
+    for (auto part = size_t{0}; part + 1 < bounds.size(); part += 2) {
+      merged_bounds.push_back(bounds[part]);
+      if (part + 2 < bounds.size()) {
+        tasks.emplace_back(
+            [&, part]() { std::inplace_merge(bounds[part], bounds[part + 1], bounds[part + 2], compare); });
+      }
+    }
+    merged_bounds.push_back(bounds.back());
+    worker_pool.execute_and_wait(std::move(tasks));
+    bounds = std::move(merged_bounds);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#include "worker_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "assert.hpp"
+
+namespace opossum {
+
+WorkerPool& WorkerPool::get() {
+  static WorkerPool instance{std::max(1u, std::thread::hardware_concurrency())};
+  return instance;
+}
+
+WorkerPool::WorkerPool(const size_t worker_count) {
+  Assert(worker_count > 0, "A worker pool needs at least one worker");
+  _workers.reserve(worker_count);
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _workers.emplace_back([this]() { _work(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(_queue_mutex);
+    _shutdown = true;
+  }
+  _queue_condition.notify_all();
+  for (auto& worker : _workers) worker.join();
+}
+
+std::future<void> WorkerPool::schedule(std::function<void()> task) {
+  auto packaged_task = std::packaged_task<void()>{std::move(task)};
+  auto future = packaged_task.get_future();
+  {
+    std::lock_guard<std::mutex> lock(_queue_mutex);
+    Assert(!_shutdown, "Cannot schedule tasks on a worker pool that is shutting down");
+    _queue.push_back(std::move(packaged_task));
+  }
+  _queue_condition.notify_one();
+  return future;
+}
+
+void WorkerPool::execute_and_wait(std::vector<std::function<void()>> tasks) {
+  auto futures = std::vector<std::future<void>>{};
+  futures.reserve(tasks.size());
+  for (auto& task : tasks) futures.push_back(schedule(std::move(task)));
+
+  for (const auto& future : futures) wait(future);
+
+  // only rethrow after all tasks have finished, as they may reference the caller's stack
+  for (auto& future : futures) future.get();
+}
+
+void WorkerPool::wait(const std::future<void>& future) {
+  // help with the queued tasks instead of blocking a thread that could make progress
+  while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+    if (!_try_run_task()) {
+      future.wait();
+    }
+  }
+}
+
+size_t WorkerPool::worker_count() const { return _workers.size(); }
+
+bool WorkerPool::_try_run_task() {
+  auto task = std::packaged_task<void()>{};
+  {
+    std::lock_guard<std::mutex> lock(_queue_mutex);
+    if (_queue.empty()) return false;
+    task = std::move(_queue.front());
+    _queue.pop_front();
+  }
+  task();
+  return true;
+}
+
+void WorkerPool::_work() {
+  while (true) {
+    auto task = std::packaged_task<void()>{};
+    {
+      std::unique_lock<std::mutex> lock(_queue_mutex);
+      _queue_condition.wait(lock, [&]() { return _shutdown || !_queue.empty(); });
+      if (_queue.empty()) return;
+      task = std::move(_queue.front());
+      _queue.pop_front();
+    }
+    task();
+  }
+}
+
+}  // namespace opossum
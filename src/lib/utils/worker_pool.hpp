@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The WorkerPool runs tasks on a fixed set of worker threads, so that parallel operations (e.g., compressing many
+// chunks) do not pay for creating and joining a thread per unit of work and never oversubscribe the cores.
+//
+// Threads that wait for their tasks in execute_and_wait() or wait() execute queued tasks themselves in the meantime. Therefore,
+// tasks may schedule and wait for further tasks without dead-locking the pool.
+class WorkerPool : private Noncopyable {
+ public:
+  // returns the global pool with one worker per hardware thread
+  static WorkerPool& get();
+
+  explicit WorkerPool(const size_t worker_count);
+
+  // finishes all queued tasks and joins the workers
+  ~WorkerPool();
+
+  WorkerPool(WorkerPool&&) = delete;
+
+  // Queues a task. The returned future becomes ready once the task has finished and rethrows its exception, if any.
+  std::future<void> schedule(std::function<void()> task);
+
+  // runs all tasks in the pool and returns once all of them have finished. The first exception thrown is rethrown.
+  void execute_and_wait(std::vector<std::function<void()>> tasks);
+
+  // Blocks until the future of a scheduled task is ready, executing queued tasks in the meantime. Unlike
+  // future.wait(), this does not dead-lock when called from a task. It does not rethrow the task's exception.
+  void wait(const std::future<void>& future);
+
+  size_t worker_count() const;
+
+ protected:
+  // runs a single queued task on the calling thread, returns false if there was none
+  bool _try_run_task();
+
+  void _work();
+
+  std::vector<std::thread> _workers;
+  std::deque<std::packaged_task<void()>> _queue;
+  std::mutex _queue_mutex;
+  std::condition_variable _queue_condition;
+  bool _shutdown = false;
+};
+
+}  // namespace opossum
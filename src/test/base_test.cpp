@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -30,6 +31,23 @@ void BaseTest::ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_p
   ASSERT_TABLE_EQ(*tleft, *tright, order_sensitive, strict_types);
 }
 
+std::shared_ptr<Table> BaseTest::_create_mixed_encoding_table(
+    const std::vector<std::pair<std::string, std::string>>& column_definitions, const uint32_t chunk_size,
+    const Matrix& rows, const std::vector<std::map<ColumnID, EncodingType>>& chunk_encodings) {
+  auto table = std::make_shared<Table>(chunk_size);
+  for (const auto& [name, type] : column_definitions) table->add_column(name, type);
+  for (const auto& row : rows) table->append(row);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_encodings.size(); ++chunk_id) {
+    for (const auto& [column_id, encoding_type] : chunk_encodings[chunk_id]) {
+      table->set_column_encoding(column_id, encoding_type);
+    }
+    table->compress_chunk(chunk_id);
+    for (const auto& column_encoding : chunk_encodings[chunk_id]) table->reset_column_encoding(column_encoding.first);
+  }
+  return table;
+}
+
 BaseTest::Matrix BaseTest::_table_to_matrix(const Table& table) {
   // initialize matrix with table sizes
   Matrix matrix(table.row_count(), std::vector<AllTypeVariant>(table.column_count()));
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "../lib/storage/encoding_type.hpp"
 #include "../lib/storage/table.hpp"
 #include "../lib/storage/value_segment.hpp"
+#include "../lib/type_cast.hpp"
 #include "../lib/types.hpp"
 
 #include "gtest/gtest.h"
@@ -46,6 +49,25 @@ class BaseTest : public ::testing::Test {
   static void ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_ptr<const Table> tright,
                               bool order_sensitive = false, bool strict_types = true);
 
+  // Creates a table with the given columns and rows. Chunk i is compressed with the encodings of chunk_encodings[i],
+  // columns without one are encoded automatically. All later chunks are not compressed.
+  static std::shared_ptr<Table> _create_mixed_encoding_table(
+      const std::vector<std::pair<std::string, std::string>>& column_definitions, const uint32_t chunk_size,
+      const Matrix& rows, const std::vector<std::map<ColumnID, EncodingType>>& chunk_encodings);
+
+  // returns the values of a column of all rows of the table
+  template <typename T>
+  static std::vector<T> _column_values(const Table& table, const ColumnID column_id) {
+    auto values = std::vector<T>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& segment = *table.get_chunk(chunk_id).get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        values.push_back(type_cast<T>(segment[chunk_offset]));
+      }
+    }
+    return values;
+  }
+
  public:
   virtual ~BaseTest();
 };
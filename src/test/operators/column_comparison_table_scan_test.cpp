@@ -0,0 +1,108 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/column_comparison_table_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsColumnComparisonTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The first chunk is dictionary encoded, the second one has a dictionary encoded and a run-length encoded column,
+    // the third one is not compressed. The dictionaries of a and b overlap only partially.
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto row = 0; row < 2500; ++row) {
+      rows.push_back({row % 50, row / 7 % 60 + 20, std::to_string(row % 13), std::to_string(row / 3 % 17)});
+    }
+    _table = _create_mixed_encoding_table(
+        {{"a", "int"}, {"b", "int"}, {"c", "string"}, {"d", "string"}}, 1000, rows,
+        {{}, {{ColumnID{1}, EncodingType::RunLength}, {ColumnID{3}, EncodingType::RunLength}}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static bool compare(const ScanType scan_type, const AllTypeVariant& left, const AllTypeVariant& right) {
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return left == right;
+      case ScanType::OpNotEquals:
+        return left != right;
+      case ScanType::OpLessThan:
+        return left < right;
+      case ScanType::OpLessThanEquals:
+        return left <= right;
+      case ScanType::OpGreaterThan:
+        return left > right;
+      case ScanType::OpGreaterThanEquals:
+        return left >= right;
+    }
+    return false;
+  }
+
+  // returns the rows of the table in which the two columns satisfy the scan type, as their values of column a
+  static std::vector<AllTypeVariant> expected_column_a(const Table& table, const ColumnID left_column_id,
+                                                       const ScanType scan_type, const ColumnID right_column_id) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        if (compare(scan_type, (*chunk.get_segment(left_column_id))[chunk_offset],
+                    (*chunk.get_segment(right_column_id))[chunk_offset])) {
+          values.push_back((*chunk.get_segment(ColumnID{0}))[chunk_offset]);
+        }
+      }
+    }
+    return values;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsColumnComparisonTableScanTest, CompareColumns) {
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto& column_ids : {std::vector<ColumnID>{ColumnID{0}, ColumnID{1}},
+                                   std::vector<ColumnID>{ColumnID{1}, ColumnID{0}},
+                                   std::vector<ColumnID>{ColumnID{2}, ColumnID{3}}}) {
+      auto scan = std::make_shared<ColumnComparisonTableScan>(_table_wrapper, column_ids[0], scan_type, column_ids[1]);
+      scan->execute();
+
+      const auto expected = expected_column_a(*_table, column_ids[0], scan_type, column_ids[1]);
+      EXPECT_EQ(expected_column_a(*scan->get_output(), ColumnID{0}, ScanType::OpEquals, ColumnID{0}), expected);
+    }
+  }
+}
+
+TEST_F(OperatorsColumnComparisonTableScanTest, CompareReferencedColumns) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 25);
+  table_scan->execute();
+  auto scan =
+      std::make_shared<ColumnComparisonTableScan>(table_scan, ColumnID{0}, ScanType::OpGreaterThan, ColumnID{1});
+  scan->execute();
+
+  const auto expected =
+      expected_column_a(*table_scan->get_output(), ColumnID{0}, ScanType::OpGreaterThan, ColumnID{1});
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(expected_column_a(*scan->get_output(), ColumnID{0}, ScanType::OpEquals, ColumnID{0}), expected);
+}
+
+TEST_F(OperatorsColumnComparisonTableScanTest, CompareColumnWithItself) {
+  auto scan = std::make_shared<ColumnComparisonTableScan>(_table_wrapper, ColumnID{2}, ScanType::OpLessThan,
+                                                          ColumnID{2});
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan->get_output()->column_count(), 4u);
+}
+
+}  // namespace opossum
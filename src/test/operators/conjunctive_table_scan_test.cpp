@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/conjunctive_table_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsConjunctiveTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // the first chunk is dictionary encoded, the second one run-length encoded, the third one is not compressed
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto row = 0; row < 2500; ++row) rows.push_back({row % 200, "value " + std::to_string(row / 10 % 10)});
+    _table = _create_mixed_encoding_table(
+        {{"a", "int"}, {"b", "string"}}, 1000, rows,
+        {{}, {{ColumnID{0}, EncodingType::RunLength}, {ColumnID{1}, EncodingType::RunLength}}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static std::vector<int> column_a(const Table& table) { return _column_values<int>(table, ColumnID{0}); }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsConjunctiveTableScanTest, ScanMultiplePredicates) {
+  auto scan = std::make_shared<ConjunctiveTableScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 50},
+                                                 {ColumnID{0}, ScanType::OpLessThan, 60},
+                                                 {ColumnID{1}, ScanType::OpNotEquals, "value 5"}});
+  scan->execute();
+
+  auto expected = std::vector<int>{};
+  for (auto row = 0; row < 2500; ++row) {
+    if (row % 200 >= 50 && row % 200 < 60 && row / 10 % 10 != 5) expected.push_back(row % 200);
+  }
+  EXPECT_EQ(column_a(*scan->get_output()), expected);
+  EXPECT_EQ(scan->get_output()->column_count(), 2u);
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, FilterFSSTSegments) {
+  _table->set_column_encoding(ColumnID{0}, EncodingType::Dictionary);
+  _table->set_column_encoding(ColumnID{1}, EncodingType::FSST);
+  _table->compress_chunk(ChunkID{2});
+
+  // the equality predicate on b is scanned first, the inequality predicate is applied as a filter after the one on a
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals}) {
+    auto scan = std::make_shared<ConjunctiveTableScan>(
+        _table_wrapper, std::vector<ScanPredicate>{{ColumnID{1}, scan_type, "value 3"},
+                                                   {ColumnID{0}, ScanType::OpLessThan, 40}});
+    scan->execute();
+
+    auto expected = std::vector<int>{};
+    for (auto row = 0; row < 2500; ++row) {
+      if (row % 200 < 40 && (row / 10 % 10 == 3) == (scan_type == ScanType::OpEquals)) expected.push_back(row % 200);
+    }
+    EXPECT_EQ(column_a(*scan->get_output()), expected);
+  }
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, ScanBetween) {
+  for (const auto lower_value : {-10, 0, 17, 199}) {
+    for (const auto upper_value : {-1, 17, 18, 150, 400}) {
+      auto scan = std::make_shared<ConjunctiveTableScan>(
+          _table_wrapper, std::vector<ScanPredicate>{ScanPredicate::between(ColumnID{0}, lower_value, upper_value)});
+      scan->execute();
+
+      auto expected = std::vector<int>{};
+      for (auto row = 0; row < 2500; ++row) {
+        if (row % 200 >= lower_value && row % 200 <= upper_value) expected.push_back(row % 200);
+      }
+      EXPECT_EQ(column_a(*scan->get_output()), expected);
+    }
+  }
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, ScanInList) {
+  // the short list is compared with the scan kernels, the long one is probed in a hash set
+  auto long_list = std::vector<AllTypeVariant>{};
+  auto long_list_values = std::vector<int>{};
+  for (auto value = 3; value < 400; value += 7) {
+    long_list.emplace_back(value);
+    long_list_values.push_back(value);
+  }
+
+  for (const auto& list_values : {std::vector<int>{}, std::vector<int>{150, 7, 7, -3, 999}, long_list_values}) {
+    auto list = std::vector<AllTypeVariant>(list_values.cbegin(), list_values.cend());
+    auto scan = std::make_shared<ConjunctiveTableScan>(
+        _table_wrapper, std::vector<ScanPredicate>{ScanPredicate::in(ColumnID{0}, list)});
+    scan->execute();
+
+    auto expected = std::vector<int>{};
+    for (auto row = 0; row < 2500; ++row) {
+      if (std::find(list_values.cbegin(), list_values.cend(), row % 200) != list_values.cend()) {
+        expected.push_back(row % 200);
+      }
+    }
+    EXPECT_EQ(column_a(*scan->get_output()), expected);
+  }
+
+  // strings, combined with another predicate, which filters the matches of the IN list or is filtered by it
+  auto scan = std::make_shared<ConjunctiveTableScan>(
+      _table_wrapper,
+      std::vector<ScanPredicate>{ScanPredicate::in(ColumnID{1}, {"value 1", "value 4", "value 42"}),
+                                 ScanPredicate::in(ColumnID{0}, long_list)});
+  scan->execute();
+
+  auto expected = std::vector<int>{};
+  for (auto row = 0; row < 2500; ++row) {
+    const auto in_long_list =
+        std::find(long_list_values.cbegin(), long_list_values.cend(), row % 200) != long_list_values.cend();
+    if ((row / 10 % 10 == 1 || row / 10 % 10 == 4) && in_long_list) expected.push_back(row % 200);
+  }
+  EXPECT_EQ(column_a(*scan->get_output()), expected);
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, MatchesChainedTableScans) {
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto search_value : {0, 5, 120, 199}) {
+      auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLessThan, "value 7");
+      first_scan->execute();
+      auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{0}, scan_type, search_value);
+      second_scan->execute();
+
+      // the conjunctive scan also accepts ReferenceSegments as input
+      auto reference_input = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 3);
+      reference_input->execute();
+      auto conjunctive_scan = std::make_shared<ConjunctiveTableScan>(
+          reference_input, std::vector<ScanPredicate>{{ColumnID{0}, scan_type, search_value},
+                                                      {ColumnID{1}, ScanType::OpLessThan, "value 7"}});
+      conjunctive_scan->execute();
+
+      auto expected = std::vector<int>{};
+      for (const auto value : column_a(*second_scan->get_output())) {
+        if (value != 3) expected.push_back(value);
+      }
+      EXPECT_EQ(column_a(*conjunctive_scan->get_output()), expected);
+    }
+  }
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, ScanWithoutMatches) {
+  auto scan = std::make_shared<ConjunctiveTableScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpEquals, 10},
+                                                 {ColumnID{0}, ScanType::OpEquals, 11}});
+  scan->execute();
+
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(scan->get_output()->get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, RejectNoPredicates) {
+  EXPECT_THROW(std::make_shared<ConjunctiveTableScan>(_table_wrapper, std::vector<ScanPredicate>{}), std::exception);
+}
+
+}  // namespace opossum
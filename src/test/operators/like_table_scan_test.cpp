@@ -0,0 +1,86 @@
+#include <memory>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/like_table_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsLikeTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // one chunk per encoding, the last one is not compressed
+    const auto words = std::vector<std::string>{"apple", "apricot", "banana", "bandana", "cherry", "grape", "ap"};
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto row = 0; row < 2500; ++row) {
+      rows.push_back({row, words[row % words.size()] + std::to_string(row / 100 % 4)});
+    }
+    _table = _create_mixed_encoding_table({{"a", "int"}, {"b", "string"}}, 500, rows,
+                                          {{},
+                                           {{ColumnID{1}, EncodingType::RunLength}},
+                                           {{ColumnID{1}, EncodingType::FSST}},
+                                           {{ColumnID{1}, EncodingType::Dictionary}}});
+    _values = _column_values<std::string>(*_table, ColumnID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // returns the rows whose values match the pattern, using a regular expression instead of the LIKE implementation
+  std::vector<int> expected_rows(const std::string& pattern) const {
+    auto regex_pattern = std::string{};
+    for (const auto character : pattern) {
+      if (character == '%') {
+        regex_pattern += ".*";
+      } else if (character == '_') {
+        regex_pattern += ".";
+      } else {
+        regex_pattern += character;
+      }
+    }
+    const auto regex = std::regex{regex_pattern};
+
+    auto rows = std::vector<int>{};
+    for (auto row = 0; row < static_cast<int>(_values.size()); ++row) {
+      if (std::regex_match(_values[row], regex)) rows.push_back(row);
+    }
+    return rows;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::vector<std::string> _values;
+};
+
+TEST_F(OperatorsLikeTableScanTest, ScanPatterns) {
+  for (const auto& pattern : {"apple2", "ap%", "ap", "%a0", "%an%", "%", "%%", "", "b_n%", "%an_na_", "a%p%1",
+                              "_____1", "%r_c%", "banana", "z%", "%z%", "ap%ap%"}) {
+    auto scan = std::make_shared<LikeTableScan>(_table_wrapper, ColumnID{1}, pattern);
+    scan->execute();
+    EXPECT_EQ(_column_values<int>(*scan->get_output(), ColumnID{0}), expected_rows(pattern)) << pattern;
+  }
+}
+
+TEST_F(OperatorsLikeTableScanTest, ScanReferenceSegments) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1000);
+  table_scan->execute();
+  auto scan = std::make_shared<LikeTableScan>(table_scan, ColumnID{1}, "%an%");
+  scan->execute();
+
+  auto expected = std::vector<int>{};
+  for (const auto row : expected_rows("%an%")) {
+    if (row >= 1000) expected.push_back(row);
+  }
+  EXPECT_EQ(_column_values<int>(*scan->get_output(), ColumnID{0}), expected);
+}
+
+}  // namespace opossum
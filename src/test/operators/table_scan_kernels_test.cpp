@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan_kernels.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanKernelsTest : public BaseTest {
+ protected:
+  static bool compare(const ScanType scan_type, const double value, const double search_value) {
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return value == search_value;
+      case ScanType::OpNotEquals:
+        return value != search_value;
+      case ScanType::OpLessThan:
+        return value < search_value;
+      case ScanType::OpLessThanEquals:
+        return value <= search_value;
+      case ScanType::OpGreaterThan:
+        return value > search_value;
+      case ScanType::OpGreaterThanEquals:
+        return value >= search_value;
+    }
+    return false;
+  }
+
+  // compares the matches of all supported kernels with those of the C++ comparison operators
+  template <typename T>
+  static void test_kernels() {
+    // 1000 values are 15 full blocks and an incomplete one, negative values wrap around for value id types
+    auto values = std::vector<T>{};
+    for (auto index = 0; index < 1000; ++index) values.push_back(static_cast<T>(index % 37 - 18));
+    values[500] = std::numeric_limits<T>::max();
+    values[501] = std::numeric_limits<T>::lowest();
+    if constexpr (std::is_floating_point_v<T>) values[502] = std::numeric_limits<T>::quiet_NaN();
+    const auto search_value = T{5};
+
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan,
+                                 ScanType::OpGreaterThanEquals}) {
+      auto expected_matches = std::vector<ChunkOffset>{};
+      for (auto index = ChunkOffset{0}; index < values.size(); ++index) {
+        // int64_t extremes are not exactly representable as doubles, but they are far from the search value
+        if (compare(scan_type, static_cast<double>(values[index]), search_value)) expected_matches.push_back(index);
+      }
+
+      for (const auto kernel_type : {ScanKernelType::Scalar, ScanKernelType::AVX2, ScanKernelType::AVX512}) {
+        if (!is_scan_kernel_supported(kernel_type)) continue;
+        auto matches = std::vector<ChunkOffset>{};
+        scan_values(values.data(), values.size(), scan_type, search_value, matches, kernel_type);
+        EXPECT_EQ(matches, expected_matches);
+      }
+    }
+  }
+
+  template <typename T>
+  static void test_pair_kernels() {
+    auto left_values = std::vector<T>{};
+    auto right_values = std::vector<T>{};
+    for (auto index = 0; index < 1000; ++index) {
+      left_values.push_back(static_cast<T>(index % 37 - 18));
+      right_values.push_back(static_cast<T>(index % 23 - 11));
+    }
+    left_values[500] = std::numeric_limits<T>::max();
+    right_values[501] = std::numeric_limits<T>::lowest();
+    if constexpr (std::is_floating_point_v<T>) right_values[502] = std::numeric_limits<T>::quiet_NaN();
+
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan,
+                                 ScanType::OpGreaterThanEquals}) {
+      auto expected_matches = std::vector<ChunkOffset>{};
+      for (auto index = ChunkOffset{0}; index < left_values.size(); ++index) {
+        if (compare(scan_type, static_cast<double>(left_values[index]), static_cast<double>(right_values[index]))) {
+          expected_matches.push_back(index);
+        }
+      }
+
+      for (const auto kernel_type : {ScanKernelType::Scalar, ScanKernelType::AVX2, ScanKernelType::AVX512}) {
+        if (!is_scan_kernel_supported(kernel_type)) continue;
+        auto matches = std::vector<ChunkOffset>{};
+        scan_value_pairs(left_values.data(), right_values.data(), left_values.size(), scan_type, matches, kernel_type);
+        EXPECT_EQ(matches, expected_matches);
+      }
+    }
+  }
+
+  template <typename T>
+  static void test_in_list_kernels() {
+    auto values = std::vector<T>{};
+    for (auto index = 0; index < 1000; ++index) values.push_back(static_cast<T>(index % 37 - 18));
+    values[500] = std::numeric_limits<T>::max();
+    if constexpr (std::is_floating_point_v<T>) values[501] = std::numeric_limits<T>::quiet_NaN();
+
+    for (const auto& search_values : {std::vector<T>{}, std::vector<T>{5}, std::vector<T>{-18, 0, 7, 18, 100},
+                                      std::vector<T>{std::numeric_limits<T>::max(), 3}}) {
+      auto expected_matches = std::vector<ChunkOffset>{};
+      for (auto index = ChunkOffset{0}; index < values.size(); ++index) {
+        if (std::find(search_values.cbegin(), search_values.cend(), values[index]) != search_values.cend()) {
+          expected_matches.push_back(index);
+        }
+      }
+
+      for (const auto kernel_type : {ScanKernelType::Scalar, ScanKernelType::AVX2, ScanKernelType::AVX512}) {
+        if (!is_scan_kernel_supported(kernel_type)) continue;
+        auto matches = std::vector<ChunkOffset>{};
+        scan_values_in(values.data(), values.size(), search_values, matches, kernel_type);
+        EXPECT_EQ(matches, expected_matches);
+      }
+    }
+  }
+};
+
+TEST_F(OperatorsTableScanKernelsTest, KernelsMatchComparisonOperators) {
+  test_kernels<int32_t>();
+  test_kernels<int64_t>();
+  test_kernels<float>();
+  test_kernels<double>();
+  test_kernels<uint8_t>();
+  test_kernels<uint16_t>();
+  test_kernels<uint32_t>();
+  test_kernels<uint64_t>();
+}
+
+TEST_F(OperatorsTableScanKernelsTest, PairKernelsMatchComparisonOperators) {
+  test_pair_kernels<int32_t>();
+  test_pair_kernels<int64_t>();
+  test_pair_kernels<float>();
+  test_pair_kernels<double>();
+}
+
+TEST_F(OperatorsTableScanKernelsTest, InListKernelsMatchComparisonOperators) {
+  test_in_list_kernels<int32_t>();
+  test_in_list_kernels<int64_t>();
+  test_in_list_kernels<float>();
+  test_in_list_kernels<double>();
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageBitPackedAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageBitPackedAttributeVectorTest, RequiredBitWidth) {
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(0), 0u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(1), 0u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(2), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(5), 3u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(64), 6u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(65), 7u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(size_t{1} << 32), 32u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, SetAndGetAcrossWordBoundaries) {
+  // 7 bits per value make value ids straddle the boundaries of the underlying 64-bit words
+  BitPackedAttributeVector attribute_vector{100, 7};
+  for (size_t i = 0; i < 100; ++i) attribute_vector.set(i, ValueID{static_cast<uint32_t>((i * 37) % 128)});
+
+  // overwriting a value must not touch its neighbors
+  attribute_vector.set(9, ValueID{127});
+  attribute_vector.set(9, ValueID{0});
+
+  EXPECT_EQ(attribute_vector.size(), 100u);
+  EXPECT_EQ(attribute_vector.bit_width(), 7u);
+  EXPECT_EQ(attribute_vector.width(), 1u);
+  for (size_t i = 0; i < 100; ++i) {
+    const auto expected = i == 9 ? ValueID{0} : ValueID{static_cast<uint32_t>((i * 37) % 128)};
+    EXPECT_EQ(attribute_vector.get(i), expected);
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, Decode) {
+  BitPackedAttributeVector attribute_vector{200, 13};
+  for (size_t i = 0; i < 200; ++i) attribute_vector.set(i, ValueID{static_cast<uint32_t>(i * 41)});
+
+  std::vector<ValueID> decoded;
+  attribute_vector.decode(17, 150, decoded);
+  ASSERT_EQ(decoded.size(), 133u);
+  for (size_t i = 0; i < decoded.size(); ++i) EXPECT_EQ(decoded[i], ValueID{static_cast<uint32_t>((i + 17) * 41)});
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, ZeroBitWidth) {
+  BitPackedAttributeVector attribute_vector{10, 0};
+  attribute_vector.set(3, ValueID{0});
+  EXPECT_EQ(attribute_vector.get(3), ValueID{0});
+  EXPECT_EQ(attribute_vector.estimate_memory_usage(), 0u);
+
+  std::vector<ValueID> decoded;
+  attribute_vector.decode(0, 10, decoded);
+  EXPECT_EQ(decoded, std::vector<ValueID>(10, ValueID{0}));
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, MemoryUsage) {
+  // 32 values of 3 bits fit into two words, plus one padding word
+  BitPackedAttributeVector attribute_vector{32, 3};
+  EXPECT_EQ(attribute_vector.estimate_memory_usage(), 3 * sizeof(uint64_t));
+}
+
+}  // namespace opossum
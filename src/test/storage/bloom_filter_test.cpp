@@ -0,0 +1,77 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  for (auto value = 0; value < 10'000; ++value) vc_int->append(value * 7);
+
+  const auto bloom_filter = BloomFilter<int>{vc_int};
+  for (auto value = 0; value < 10'000; ++value) {
+    EXPECT_TRUE(bloom_filter.may_contain(value * 7));
+    EXPECT_FALSE(bloom_filter.can_prune(ScanType::OpEquals, value * 7));
+  }
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  auto bloom_filter = BloomFilter<int>{10'000};
+  for (auto value = 0; value < 10'000; ++value) bloom_filter.insert(value);
+
+  auto false_positives = 0;
+  for (auto value = 10'000; value < 110'000; ++value) false_positives += bloom_filter.may_contain(value);
+  EXPECT_LT(false_positives, 2'000);
+}
+
+TEST_F(StorageBloomFilterTest, OnlyPrunesEquality) {
+  vc_int->append(4);
+  const auto bloom_filter = BloomFilter<int>{vc_int};
+
+  EXPECT_FALSE(bloom_filter.can_prune(ScanType::OpNotEquals, 4));
+  EXPECT_FALSE(bloom_filter.can_prune(ScanType::OpLessThan, 1));
+}
+
+TEST_F(StorageBloomFilterTest, BuildFromDictionarySegment) {
+  for (const auto& value : {"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"}) vc_str->append(value);
+  const auto dictionary_segment = std::make_shared<DictionarySegment<std::string>>(vc_str);
+
+  const auto bloom_filter = BloomFilter<std::string>{dictionary_segment};
+  for (const auto& value : {"Bill", "Steve", "Alexander", "Hasso"}) EXPECT_TRUE(bloom_filter.may_contain(value));
+  EXPECT_EQ(bloom_filter.estimate_memory_usage(), 8u);
+}
+
+TEST_F(StorageBloomFilterTest, TablePrunesChunksForPointLookups) {
+  auto table = Table{1000};
+  table.add_column("session_id", "long");
+  table.set_bloom_filter(ColumnID{0}, true);
+  EXPECT_TRUE(table.has_bloom_filter(ColumnID{0}));
+
+  // unordered ids, so every chunk's min/max spans almost the whole domain
+  for (auto row = int64_t{0}; row < 200'000; ++row) table.append({(row * 2'654'435'761) % 1'000'003});
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) table.compress_chunk(chunk_id);
+
+  const auto search_value = AllTypeVariant{int64_t{(12'345 * 2'654'435'761) % 1'000'003}};
+  auto scanned_chunks = 0;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    scanned_chunks += !table.get_chunk(chunk_id).can_prune(ColumnID{0}, ScanType::OpEquals, search_value);
+  }
+  EXPECT_GE(scanned_chunks, 1);
+  EXPECT_LE(scanned_chunks, 8);
+  EXPECT_FALSE(table.get_chunk(ChunkID{12}).can_prune(ColumnID{0}, ScanType::OpEquals, search_value));
+}
+
+}  // namespace opossum
@@ -1,4 +1,8 @@
+#include <algorithm>
 #include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -6,6 +10,7 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_segment.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/value_segment.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
@@ -60,6 +65,73 @@ TEST_F(StorageChunkTest, RetrieveSegment) {
   EXPECT_EQ(base_segment->size(), 4u);
 }
 
+TEST_F(StorageChunkTest, TryAppendToPresizedChunk) {
+  c.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>("int"));
+  EXPECT_FALSE(c.try_append({1}));
+
+  c.presize(2);
+  c.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>("string"));
+  EXPECT_EQ(c.size(), 0u);
+  EXPECT_EQ(c.try_append({1, "one"}), ChunkOffset{0});
+  EXPECT_EQ(c.try_append({2, "two"}), ChunkOffset{1});
+  EXPECT_FALSE(c.try_append({3, "three"}));
+  EXPECT_EQ(c.size(), 2u);
+  EXPECT_EQ((*c.get_segment(ColumnID{1}))[1], AllTypeVariant{"two"});
+
+  EXPECT_THROW(c.add_segment(int_value_segment), std::exception);
+  EXPECT_THROW(c.presize(4), std::exception);
+}
+
+TEST_F(StorageChunkTest, PresizedChunkGrows) {
+  c.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>("int"));
+  constexpr auto CAPACITY = Chunk::INITIAL_PRESIZED_CAPACITY * 3;
+  c.presize(CAPACITY);
+  // only the initial rows are allocated up front
+  EXPECT_EQ(c.get_segment(ColumnID{0})->estimate_memory_usage(), Chunk::INITIAL_PRESIZED_CAPACITY * sizeof(int));
+
+  // the writers of each thread reserve rows while others grow the chunk
+  constexpr auto THREAD_COUNT = 4;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto row = ChunkOffset{0}; row < CAPACITY / THREAD_COUNT; ++row) ASSERT_TRUE(c.try_append({1}));
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(c.size(), CAPACITY);
+  EXPECT_TRUE(c.is_sealed());
+  EXPECT_FALSE(c.try_append({1}));
+  const auto& segment = static_cast<const ValueSegment<int>&>(*c.get_segment(ColumnID{0}));
+  const auto values = segment.values();
+  EXPECT_EQ(std::count(values.begin(), values.end(), 1), CAPACITY);
+}
+
+TEST_F(StorageChunkTest, SealStopsGrowth) {
+  c.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>("int"));
+  c.presize(Chunk::INITIAL_PRESIZED_CAPACITY * 2);
+  for (auto row = ChunkOffset{0}; row < Chunk::INITIAL_PRESIZED_CAPACITY + 1; ++row) c.append({1});
+
+  c.seal();
+  EXPECT_TRUE(c.is_sealed());
+  EXPECT_FALSE(c.try_append({1}));
+  EXPECT_EQ(c.size(), Chunk::INITIAL_PRESIZED_CAPACITY + 1);
+}
+
+TEST_F(StorageChunkTest, TryAppendSegmentsToPresizedChunk) {
+  c.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>("int"));
+  c.presize(3);
+  c.append({1});
+
+  const auto segments = std::vector<std::shared_ptr<const BaseValueSegment>>{
+      std::make_shared<ValueSegment<int>>(std::vector<int>{2, 3, 4})};
+  // only two rows are free
+  EXPECT_EQ(c.try_append_segments(segments, 0, 3), std::make_pair(ChunkOffset{1}, ChunkOffset{2}));
+  EXPECT_FALSE(c.try_append_segments(segments, 2, 1));
+  EXPECT_EQ(c.size(), 3u);
+  EXPECT_EQ((*c.get_segment(ColumnID{0}))[2], AllTypeVariant{3});
+}
+
 TEST_F(StorageChunkTest, UnknownSegmentType) {
   // Exception will only be thrown in debug builds
   if (IS_DEBUG) {
@@ -1,12 +1,15 @@
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "resolve_type.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -42,6 +45,20 @@ namespace opossum {
    EXPECT_EQ((*dict)[3], "Steve");
  }
 
+ TEST_F(StorageDictionarySegmentTest, LowerUpperBoundString) {
+  for (const auto& value : {"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"}) vc_str->append(value);
+  auto col = make_shared_by_data_type<BaseSegment, DictionarySegment>("string", vc_str);
+  auto dict_col = std::dynamic_pointer_cast<DictionarySegment<std::string>>(col);
+
+  EXPECT_EQ(dict_col->lower_bound(std::string{"Bill"}), ValueID{1});
+  EXPECT_EQ(dict_col->upper_bound(std::string{"Bill"}), ValueID{2});
+  EXPECT_EQ(dict_col->lower_bound(std::string{"C"}), ValueID{2});
+  EXPECT_EQ(dict_col->upper_bound(std::string{"Steve"}), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->value_by_value_id(ValueID{2}), "Hasso");
+  EXPECT_THROW(dict_col->value_by_value_id(ValueID{4}), std::exception);
+  EXPECT_EQ(dict_col->get(4), "Hasso");
+}
+
  TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
    for (int i = 0; i <= 10; i += 2) vc_int->append(i);
    auto col = make_shared_by_data_type<BaseSegment, DictionarySegment>("int", vc_int);
@@ -64,8 +81,63 @@ TEST_F(StorageDictionarySegmentTest, MemoryUsage) {
   auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("int", vc_int);
   auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int>>(col);
 
-  // expect 4 bytes for int in dictionary and two bytes in attribute vector
-  EXPECT_EQ(dict_col->estimate_memory_usage(), size_t{6});
+  // expect 4 bytes for int in dictionary and no bytes in attribute vector, as a single value id needs zero bits
+  EXPECT_EQ(dict_col->estimate_memory_usage(), size_t{4});
+}
+
+TEST_F(StorageDictionarySegmentTest, BitPackedAttributeVector) {
+  for (int i = 0; i < 100; ++i) vc_int->append(i % 5);
+  auto col = make_shared_by_data_type<BaseSegment, DictionarySegment>("int", vc_int);
+  auto dict_col = std::dynamic_pointer_cast<DictionarySegment<int>>(col);
+
+  // five distinct values need three bits per row
+  auto attribute_vector = std::dynamic_pointer_cast<const BitPackedAttributeVector>(dict_col->attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_EQ(attribute_vector->bit_width(), 3u);
+  for (ChunkOffset chunk_offset = 0; chunk_offset < 100; ++chunk_offset) {
+    EXPECT_EQ(dict_col->get(chunk_offset), static_cast<int>(chunk_offset % 5));
+  }
+
+  // 300 bits fit into five 64-bit words, plus one padding word
+  EXPECT_EQ(dict_col->estimate_memory_usage(), 5 * sizeof(int) + 6 * sizeof(uint64_t));
+}
+
+TEST_F(StorageDictionarySegmentTest, FixedSizeAttributeVectorForNativeWidth) {
+  for (int i = 0; i < 256; ++i) vc_int->append(i);
+  auto col = make_shared_by_data_type<BaseSegment, DictionarySegment>("int", vc_int);
+  auto dict_col = std::dynamic_pointer_cast<DictionarySegment<int>>(col);
+
+  // 256 distinct values need exactly eight bits, so packing would not save anything
+  EXPECT_TRUE(std::dynamic_pointer_cast<const FixedSizeAttributeVector<uint8_t>>(dict_col->attribute_vector()));
+  EXPECT_EQ(dict_col->get(255), 255);
+}
+
+TEST_F(StorageDictionarySegmentTest, UnsortedValuesWithDuplicates) {
+  const auto values = std::vector<std::string>{"Steve", "Bill", "Hasso", "Bill", "Alexander", "Steve", "Hasso"};
+  for (const auto& value : values) vc_str->append(value);
+  auto dict_col = std::make_shared<DictionarySegment<std::string>>(vc_str);
+
+  EXPECT_EQ(dict_col->unique_values_count(), 4u);
+  for (ChunkOffset chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+    EXPECT_EQ(dict_col->get(chunk_offset), values[chunk_offset]);
+  }
+
+  // value ids follow the sort order of the values
+  const auto attribute_vector = dict_col->attribute_vector();
+  EXPECT_EQ(attribute_vector->get(4), ValueID{0});
+  EXPECT_EQ(attribute_vector->get(1), ValueID{1});
+  EXPECT_EQ(attribute_vector->get(2), ValueID{2});
+  EXPECT_EQ(attribute_vector->get(0), ValueID{3});
+}
+
+TEST_F(StorageDictionarySegmentTest, WideAttributeVector) {
+  for (int i = 70'000; i > 0; --i) vc_int->append(i * 3);
+  auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitPackedAttributeVector>(dict_col->attribute_vector()));
+  EXPECT_EQ(dict_col->unique_values_count(), 70'000u);
+  EXPECT_EQ(dict_col->attribute_vector()->get(0), ValueID{69'999});
+  EXPECT_EQ(dict_col->get(69'999), 3);
 }
 
-}  // namespace opossum
\ No newline at end of file
+}  // namespace opossum
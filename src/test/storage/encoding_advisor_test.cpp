@@ -0,0 +1,99 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/encoding_advisor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageEncodingAdvisorTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<float>> vc_float = std::make_shared<ValueSegment<float>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageEncodingAdvisorTest, EstimatesOnlyApplicableEncodings) {
+  vc_int->append(1);
+  vc_str->append("Bill");
+
+  const auto int_estimates = EncodingAdvisor::estimate_memory_usage("int", vc_int);
+  EXPECT_EQ(int_estimates.count(EncodingType::FrameOfReference), 1u);
+  EXPECT_EQ(int_estimates.count(EncodingType::FSST), 0u);
+
+  const auto string_estimates = EncodingAdvisor::estimate_memory_usage("string", vc_str);
+  EXPECT_EQ(string_estimates.count(EncodingType::FrameOfReference), 0u);
+  EXPECT_EQ(string_estimates.count(EncodingType::FSST), 1u);
+}
+
+TEST_F(StorageEncodingAdvisorTest, EmptySegmentStaysUnencoded) {
+  EXPECT_EQ(EncodingAdvisor::choose_encoding("int", vc_int), EncodingType::Unencoded);
+}
+
+TEST_F(StorageEncodingAdvisorTest, ChoosesRunLengthForSortedValues) {
+  for (auto index = 0; index < 50'000; ++index) vc_int->append(index / 1000 * 1'000'000);
+
+  EXPECT_EQ(EncodingAdvisor::choose_encoding("int", vc_int), EncodingType::RunLength);
+}
+
+TEST_F(StorageEncodingAdvisorTest, ChoosesFrameOfReferenceForNarrowRanges) {
+  // unique timestamps that increase slowly
+  for (auto index = 0; index < 50'000; ++index) vc_int->append(1'500'000'000 + index * 3 + index % 2);
+
+  EXPECT_EQ(EncodingAdvisor::choose_encoding("int", vc_int), EncodingType::FrameOfReference);
+}
+
+TEST_F(StorageEncodingAdvisorTest, ChoosesDictionaryForFewDistinctStrings) {
+  for (auto index = 0; index < 50'000; ++index) {
+    vc_str->append("Department of " + std::to_string((index * 7) % 13));
+  }
+
+  EXPECT_EQ(EncodingAdvisor::choose_encoding("string", vc_str), EncodingType::Dictionary);
+}
+
+TEST_F(StorageEncodingAdvisorTest, EstimatesFSSTForUniqueStrings) {
+  for (auto index = 0; index < 50'000; ++index) {
+    vc_str->append("GET /api/v1/users/" + std::to_string(index * 7919) + "/orders?status=shipped");
+  }
+
+  const auto estimates = EncodingAdvisor::estimate_memory_usage("string", vc_str);
+  EXPECT_LT(estimates.at(EncodingType::FSST), estimates.at(EncodingType::Unencoded) / 2);
+
+  const auto encoded_size = encode_segment(EncodingType::FSST, "string", vc_str)->estimate_memory_usage();
+  EXPECT_NEAR(static_cast<double>(estimates.at(EncodingType::FSST)), static_cast<double>(encoded_size),
+              0.2 * static_cast<double>(encoded_size));
+}
+
+TEST_F(StorageEncodingAdvisorTest, KeepsUniqueFloatsUnencoded) {
+  for (auto index = 0; index < 10'000; ++index) vc_float->append(static_cast<float>(index) * 1.5f);
+
+  EXPECT_EQ(EncodingAdvisor::choose_encoding("float", vc_float), EncodingType::Unencoded);
+}
+
+TEST_F(StorageEncodingAdvisorTest, EstimateMatchesEncodedSize) {
+  for (auto index = 0; index < 100'000; ++index) vc_int->append((index * 31) % 100);
+
+  const auto estimates = EncodingAdvisor::estimate_memory_usage("int", vc_int);
+  const auto encoding_type = EncodingAdvisor::choose_encoding("int", vc_int);
+  EXPECT_EQ(encoding_type, EncodingType::Dictionary);
+
+  const auto encoded_segment = encode_segment(encoding_type, "int", vc_int);
+  EXPECT_EQ(get_encoding_type("int", encoded_segment), EncodingType::Dictionary);
+  EXPECT_NEAR(static_cast<double>(estimates.at(encoding_type)),
+              static_cast<double>(encoded_segment->estimate_memory_usage()),
+              0.05 * static_cast<double>(encoded_segment->estimate_memory_usage()));
+}
+
+TEST_F(StorageEncodingAdvisorTest, EncodeRejectsUnsupportedDataType) {
+  vc_str->append("Bill");
+
+  EXPECT_THROW(encode_segment(EncodingType::FrameOfReference, "string", vc_str), std::exception);
+  EXPECT_THROW(encode_segment(EncodingType::FSST, "int", vc_int), std::exception);
+  EXPECT_EQ(encode_segment(EncodingType::Unencoded, "string", vc_str), vc_str);
+}
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/fixed_size_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageFixedSizeAttributeVectorTest : public BaseTest {
+ protected:
+  template <typename T>
+  void _test_decode() {
+    // 101 values are not a multiple of any SIMD width, so the scalar tail is exercised as well
+    FixedSizeAttributeVector<T> attribute_vector{101};
+    for (size_t i = 0; i < 101; ++i) attribute_vector.set(i, ValueID{static_cast<uint32_t>((i * 7) % 251)});
+
+    std::vector<ValueID> decoded;
+    for (const auto& range : std::vector<std::pair<size_t, size_t>>{{0, 101}, {3, 40}, {50, 50}, {99, 101}}) {
+      attribute_vector.decode(range.first, range.second, decoded);
+      ASSERT_EQ(decoded.size(), range.second - range.first);
+      for (size_t i = 0; i < decoded.size(); ++i) {
+        EXPECT_EQ(decoded[i], attribute_vector.get(range.first + i));
+      }
+    }
+  }
+};
+
+TEST_F(StorageFixedSizeAttributeVectorTest, SetAndGet) {
+  FixedSizeAttributeVector<uint16_t> attribute_vector{3};
+  attribute_vector.set(0, ValueID{7});
+  attribute_vector.set(2, ValueID{1000});
+
+  EXPECT_EQ(attribute_vector.size(), 3u);
+  EXPECT_EQ(attribute_vector.width(), 2u);
+  EXPECT_EQ(attribute_vector.get(0), ValueID{7});
+  EXPECT_EQ(attribute_vector.get(1), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(2), ValueID{1000});
+  EXPECT_EQ(attribute_vector.values()[2], 1000u);
+  EXPECT_EQ(attribute_vector.estimate_memory_usage(), 6u);
+}
+
+TEST_F(StorageFixedSizeAttributeVectorTest, DecodeUint8) { _test_decode<uint8_t>(); }
+
+TEST_F(StorageFixedSizeAttributeVectorTest, DecodeUint16) { _test_decode<uint16_t>(); }
+
+TEST_F(StorageFixedSizeAttributeVectorTest, DecodeUint32) { _test_decode<uint32_t>(); }
+
+TEST_F(StorageFixedSizeAttributeVectorTest, DecodeThroughBaseClass) {
+  std::shared_ptr<BaseAttributeVector> attribute_vector = std::make_shared<FixedSizeAttributeVector<uint8_t>>(40);
+  for (size_t i = 0; i < 40; ++i) attribute_vector->set(i, ValueID{static_cast<uint32_t>(i)});
+
+  std::vector<ValueID> decoded;
+  attribute_vector->decode(8, 40, decoded);
+  ASSERT_EQ(decoded.size(), 32u);
+  EXPECT_EQ(decoded.front(), ValueID{8});
+  EXPECT_EQ(decoded.back(), ValueID{39});
+}
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<int64_t>> vc_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressNarrowRange) {
+  // epoch seconds within a couple of hours, in three blocks
+  for (int32_t i = 0; i < 5000; ++i) vc_int->append(1'577'836'800 + (i * 7919) % 8000);
+  auto for_col = std::make_shared<FrameOfReferenceSegment<int32_t>>(vc_int);
+
+  EXPECT_EQ(for_col->size(), 5000u);
+  EXPECT_EQ(for_col->block_count(), 3u);
+  for (ChunkOffset chunk_offset = 0; chunk_offset < 5000; ++chunk_offset) {
+    EXPECT_EQ(for_col->get(chunk_offset), vc_int->values()[chunk_offset]);
+  }
+
+  // offsets below 8000 need 13 bits instead of 32
+  EXPECT_EQ(for_col->block_bit_width(0), 13u);
+  EXPECT_LT(for_col->estimate_memory_usage(), vc_int->estimate_memory_usage() / 2);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, Decode) {
+  for (int64_t i = 0; i < 3000; ++i) vc_long->append(int64_t{1} << 40 | (i % 300));
+  auto for_col = std::make_shared<FrameOfReferenceSegment<int64_t>>(vc_long);
+
+  std::vector<int64_t> decoded;
+  for_col->decode(2000, 2100, decoded);
+  ASSERT_EQ(decoded.size(), 100u);
+  for (size_t i = 0; i < decoded.size(); ++i) EXPECT_EQ(decoded[i], vc_long->values()[2000 + i]);
+
+  EXPECT_EQ((*for_col)[42], AllTypeVariant{vc_long->values()[42]});
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, DecodeOffsets) {
+  for (int32_t i = 0; i < 10; ++i) vc_int->append(-5 + i * i);
+  auto for_col = std::make_shared<FrameOfReferenceSegment<int32_t>>(vc_int);
+
+  EXPECT_EQ(for_col->block_minimum(0), -5);
+  std::vector<uint32_t> offsets;
+  for_col->decode_offsets(0, offsets);
+  ASSERT_EQ(offsets.size(), 10u);
+  for (uint32_t i = 0; i < 10; ++i) EXPECT_EQ(offsets[i], i * i);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, FullValueRange) {
+  vc_int->append(std::numeric_limits<int32_t>::min());
+  vc_int->append(std::numeric_limits<int32_t>::max());
+  vc_int->append(0);
+  auto for_col = std::make_shared<FrameOfReferenceSegment<int32_t>>(vc_int);
+
+  EXPECT_EQ(for_col->block_bit_width(0), 32u);
+  EXPECT_EQ(for_col->get(0), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(for_col->get(1), std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(for_col->get(2), 0);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, ConstantBlock) {
+  for (int i = 0; i < 100; ++i) vc_int->append(17);
+  auto for_col = std::make_shared<FrameOfReferenceSegment<int32_t>>(vc_int);
+
+  EXPECT_EQ(for_col->block_bit_width(0), 0u);
+  EXPECT_EQ(for_col->get(99), 17);
+  EXPECT_THROW(for_col->append(4), std::exception);
+
+  // the constant block is the last one, so it has no words of its own to read (caught by the sanitizer build)
+  std::vector<int32_t> decoded;
+  for_col->decode(90, 100, decoded);
+  EXPECT_EQ(decoded, std::vector<int32_t>(10, 17));
+  std::vector<uint32_t> offsets;
+  for_col->decode_offsets(0, offsets);
+  EXPECT_EQ(offsets, std::vector<uint32_t>(100, 0));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, ConstantLastBlock) {
+  const auto block_size = FrameOfReferenceSegment<int64_t>::BLOCK_SIZE;
+  for (auto i = int64_t{0}; i < block_size + 10; ++i) vc_long->append(i < block_size ? i : int64_t{-3});
+  auto for_col = std::make_shared<FrameOfReferenceSegment<int64_t>>(vc_long);
+
+  EXPECT_EQ(for_col->block_bit_width(1), 0u);
+  EXPECT_EQ(for_col->get(block_size - 1), block_size - 1);
+  EXPECT_EQ(for_col->get(block_size + 9), -3);
+
+  std::vector<int64_t> decoded;
+  for_col->decode(block_size - 2, block_size + 10, decoded);
+  ASSERT_EQ(decoded.size(), 12u);
+  EXPECT_EQ(decoded[1], block_size - 1);
+  EXPECT_EQ(decoded[2], -3);
+  EXPECT_EQ(decoded[11], -3);
+}
+
+}  // namespace opossum
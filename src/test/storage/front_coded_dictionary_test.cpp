@@ -0,0 +1,123 @@
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/front_coded_dictionary.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 40 values span three blocks and share long prefixes
+    for (auto index = 0; index < 40; ++index) {
+      values.push_back("https://example.com/page/" + std::to_string(1000 + index * 3));
+    }
+  }
+
+  std::vector<std::string> values;
+};
+
+TEST_F(StorageFrontCodedDictionaryTest, RandomAccess) {
+  const auto dictionary = FrontCodedDictionary{values};
+  ASSERT_EQ(dictionary.size(), values.size());
+  for (auto index = size_t{0}; index < values.size(); ++index) EXPECT_EQ(dictionary[index], values[index]);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, LowerUpperBound) {
+  const auto dictionary = FrontCodedDictionary{values};
+
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(dictionary.lower_bound(values[index]), index);
+    EXPECT_EQ(dictionary.upper_bound(values[index]), index + 1);
+  }
+
+  // values between two entries, at both ends of a block, and outside of the dictionary's range
+  EXPECT_EQ(dictionary.lower_bound("https://example.com/page/1001"), 1u);
+  EXPECT_EQ(dictionary.upper_bound("https://example.com/page/1001"), 1u);
+  EXPECT_EQ(dictionary.lower_bound("https://example.com/page/1046"), 16u);
+  EXPECT_EQ(dictionary.lower_bound("a"), 0u);
+  EXPECT_EQ(dictionary.upper_bound("a"), 0u);
+  EXPECT_EQ(dictionary.lower_bound("z"), 40u);
+  EXPECT_EQ(dictionary.upper_bound("z"), 40u);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, ForEach) {
+  const auto dictionary = FrontCodedDictionary{values};
+
+  auto decoded = std::vector<std::string>{};
+  dictionary.for_each([&](const size_t index, const std::string& value) {
+    EXPECT_EQ(index, decoded.size());
+    decoded.push_back(value);
+  });
+  EXPECT_EQ(decoded, values);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, EmptyAndShortValues) {
+  const auto dictionary = FrontCodedDictionary{{"", "a", "ab", "abc", "b"}};
+  EXPECT_EQ(dictionary[0], "");
+  EXPECT_EQ(dictionary[3], "abc");
+  EXPECT_EQ(dictionary.lower_bound(""), 0u);
+  EXPECT_EQ(dictionary.upper_bound(""), 1u);
+  EXPECT_EQ(dictionary.lower_bound("abb"), 3u);
+
+  const auto empty_dictionary = FrontCodedDictionary{{}};
+  EXPECT_EQ(empty_dictionary.size(), 0u);
+  EXPECT_EQ(empty_dictionary.lower_bound("a"), 0u);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, LongValues) {
+  // values longer than 127 characters need multi-byte length prefixes
+  const auto prefix = std::string(300, 'x');
+  const auto dictionary = FrontCodedDictionary{{prefix + "a", prefix + "b" + std::string(200, 'y')}};
+  EXPECT_EQ(dictionary[0], prefix + "a");
+  EXPECT_EQ(dictionary[1], prefix + "b" + std::string(200, 'y'));
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, CompressedWithSymbolTable) {
+  // values with repeated substrings that do not form a common prefix
+  auto log_values = std::vector<std::string>{};
+  for (auto index = 0; index < 1000; ++index) {
+    log_values.push_back(std::to_string(100000 + index) + " user logged in from host-" + std::to_string(index % 7) +
+                         ".example.com via ssh");
+  }
+
+  const auto symbol_table = FrontCodedDictionary::train_symbol_table(log_values);
+  ASSERT_TRUE(symbol_table);
+
+  const auto dictionary = FrontCodedDictionary{log_values, symbol_table};
+  const auto uncompressed_dictionary = FrontCodedDictionary{log_values};
+  EXPECT_EQ(dictionary.symbol_table(), symbol_table);
+  EXPECT_LT(dictionary.estimate_memory_usage(), uncompressed_dictionary.estimate_memory_usage());
+
+  for (auto index = size_t{0}; index < log_values.size(); index += 37) {
+    EXPECT_EQ(dictionary[index], log_values[index]);
+    EXPECT_EQ(dictionary.lower_bound(log_values[index]), index);
+    EXPECT_EQ(dictionary.upper_bound(log_values[index]), index + 1);
+  }
+
+  auto count = size_t{0};
+  dictionary.for_each([&](const size_t index, const std::string& value) {
+    EXPECT_EQ(value, log_values[index]);
+    ++count;
+  });
+  EXPECT_EQ(count, log_values.size());
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, NoSymbolTableForSmallDictionaries) {
+  EXPECT_FALSE(FrontCodedDictionary::train_symbol_table(values));
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, MemoryUsage) {
+  const auto dictionary = FrontCodedDictionary{values};
+
+  auto plain_size = size_t{0};
+  for (const auto& value : values) plain_size += value.size();
+
+  // shared prefixes are only stored once per block
+  EXPECT_LT(dictionary.estimate_memory_usage(), plain_size / 2);
+}
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/fsst_segment.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = 0; index < 1000; ++index) {
+      vc_str->append("GET /api/v1/users/" + std::to_string(index % 50) + "/orders HTTP/1.1 200");
+    }
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageFSSTSegmentTest, RandomAccess) {
+  const auto fsst_col = std::make_shared<FSSTSegment>(vc_str);
+
+  ASSERT_EQ(fsst_col->size(), 1000u);
+  for (ChunkOffset chunk_offset = 0; chunk_offset < 1000; ++chunk_offset) {
+    EXPECT_EQ(fsst_col->get(chunk_offset), vc_str->values()[chunk_offset]);
+  }
+  EXPECT_EQ((*fsst_col)[7], AllTypeVariant{vc_str->values()[7]});
+}
+
+TEST_F(StorageFSSTSegmentTest, EqualsOnCompressedForm) {
+  const auto fsst_col = std::make_shared<FSSTSegment>(vc_str);
+  const auto compressed = fsst_col->compress("GET /api/v1/users/7/orders HTTP/1.1 200");
+
+  for (ChunkOffset chunk_offset = 0; chunk_offset < 1000; ++chunk_offset) {
+    EXPECT_EQ(fsst_col->equals(chunk_offset, compressed), chunk_offset % 50 == 7);
+  }
+  EXPECT_FALSE(fsst_col->equals(0, fsst_col->compress("no such value")));
+}
+
+TEST_F(StorageFSSTSegmentTest, MemoryUsage) {
+  const auto fsst_col = std::make_shared<FSSTSegment>(vc_str);
+
+  auto character_count = size_t{0};
+  for (const auto& value : vc_str->values()) character_count += value.size();
+
+  EXPECT_LT(fsst_col->estimate_memory_usage(), character_count / 2);
+}
+
+TEST_F(StorageFSSTSegmentTest, IsImmutable) {
+  const auto fsst_col = std::make_shared<FSSTSegment>(vc_str);
+  EXPECT_THROW(fsst_col->append("value"), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/fsst_symbol_table.hpp"
+
+namespace opossum {
+
+class StorageFSSTSymbolTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = 0; index < 500; ++index) {
+      values.push_back("INFO [worker-" + std::to_string(index % 8) + "] request " + std::to_string(index * 17) +
+                       " completed successfully in " + std::to_string(index % 100) + " ms");
+    }
+  }
+
+  std::vector<std::string> values;
+};
+
+TEST_F(StorageFSSTSymbolTableTest, RoundTrip) {
+  const auto symbol_table = FSSTSymbolTable::build(values);
+  EXPECT_GT(symbol_table->symbol_count(), 0u);
+  EXPECT_LE(symbol_table->symbol_count(), FSSTSymbolTable::MAX_SYMBOL_COUNT);
+
+  for (const auto& value : values) {
+    const auto compressed = symbol_table->compress(value);
+    EXPECT_LT(compressed.size(), value.size());
+    EXPECT_EQ(symbol_table->decompress(compressed.data(), compressed.size()), value);
+  }
+}
+
+TEST_F(StorageFSSTSymbolTableTest, CompressionRatio) {
+  const auto symbol_table = FSSTSymbolTable::build(values);
+  EXPECT_LT(symbol_table->compression_ratio(), 0.5);
+}
+
+TEST_F(StorageFSSTSymbolTableTest, UnknownBytesAreEscaped) {
+  const auto symbol_table = FSSTSymbolTable::build(values);
+
+  // bytes that never occur in the training data, including the escape code itself
+  const auto value = std::string{"\xff\x01\x00 ERROR", 9};
+  const auto compressed = symbol_table->compress(value);
+  EXPECT_EQ(symbol_table->decompress(compressed.data(), compressed.size()), value);
+  EXPECT_EQ(symbol_table->compress(""), "");
+}
+
+TEST_F(StorageFSSTSymbolTableTest, EqualityOnCompressedForm) {
+  const auto symbol_table = FSSTSymbolTable::build(values);
+  EXPECT_EQ(symbol_table->compress(values[3]), symbol_table->compress(std::string{values[3]}));
+  EXPECT_NE(symbol_table->compress(values[3]), symbol_table->compress(values[4]));
+}
+
+TEST_F(StorageFSSTSymbolTableTest, EmptyTable) {
+  const auto symbol_table = FSSTSymbolTable::build({});
+  EXPECT_EQ(symbol_table->symbol_count(), 0u);
+
+  const auto compressed = symbol_table->compress("abc");
+  EXPECT_EQ(compressed.size(), 6u);
+  EXPECT_EQ(symbol_table->decompress(compressed.data(), compressed.size()), "abc");
+}
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/pos_list_utils.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StoragePosListTest : public BaseTest {
+ protected:
+  template <typename PosListType>
+  static std::vector<RowID> expand(const PosListType& pos_list) {
+    auto row_ids = std::vector<RowID>{};
+    pos_list.for_each([&](const size_t index, const RowID& row_id) {
+      EXPECT_EQ(index, row_ids.size());
+      EXPECT_EQ(pos_list.get(index), row_id);
+      row_ids.push_back(row_id);
+    });
+    return row_ids;
+  }
+
+  static std::vector<RowID> to_row_ids(const ChunkID chunk_id, const std::vector<ChunkOffset>& chunk_offsets) {
+    auto row_ids = std::vector<RowID>{};
+    for (const auto chunk_offset : chunk_offsets) row_ids.push_back(RowID{chunk_id, chunk_offset});
+    return row_ids;
+  }
+};
+
+TEST_F(StoragePosListTest, RangePosList) {
+  const auto pos_list = RangePosList{ChunkID{3}, 5, 9};
+  EXPECT_EQ(pos_list.size(), 4u);
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(expand(pos_list), to_row_ids(ChunkID{3}, {5, 6, 7, 8}));
+}
+
+TEST_F(StoragePosListTest, AddingPositionsRevokesSingleChunkGuarantee) {
+  auto pos_list = PosList{to_row_ids(ChunkID{1}, {4, 2})};
+  EXPECT_FALSE(pos_list.references_single_chunk());
+  pos_list.guarantee_single_chunk();
+  EXPECT_TRUE(pos_list.references_single_chunk());
+
+  pos_list.push_back(RowID{ChunkID{2}, 0});
+  EXPECT_FALSE(pos_list.references_single_chunk());
+  EXPECT_EQ(expand(pos_list), (std::vector<RowID>{{ChunkID{1}, 4}, {ChunkID{1}, 2}, {ChunkID{2}, 0}}));
+}
+
+TEST_F(StoragePosListTest, BitmapPosList) {
+  // a sparse block that is stored as an array and a dense block that is stored as a bitmap
+  auto chunk_offsets = std::vector<ChunkOffset>{3, 17, 65'535};
+  for (auto chunk_offset = ChunkOffset{65'536}; chunk_offset < 3 * 65'536; chunk_offset += 3) {
+    chunk_offsets.push_back(chunk_offset);
+  }
+
+  const auto pos_list = BitmapPosList{ChunkID{2}, chunk_offsets};
+  EXPECT_EQ(pos_list.size(), chunk_offsets.size());
+  EXPECT_EQ(expand(pos_list), to_row_ids(ChunkID{2}, chunk_offsets));
+  EXPECT_EQ(pos_list.memory_usage(), BitmapPosList::estimate_memory_usage(chunk_offsets));
+  EXPECT_LT(pos_list.memory_usage(), chunk_offsets.size() * sizeof(RowID) / 10);
+}
+
+TEST_F(StoragePosListTest, MakeSingleChunkPosList) {
+  const auto contiguous = make_single_chunk_pos_list(ChunkID{1}, {4, 5, 6});
+  ASSERT_TRUE(std::dynamic_pointer_cast<const RangePosList>(contiguous));
+  EXPECT_EQ(contiguous->get(2), (RowID{ChunkID{1}, 6}));
+
+  EXPECT_EQ(make_single_chunk_pos_list(ChunkID{1}, {})->size(), 0u);
+
+  const auto sparse = make_single_chunk_pos_list(ChunkID{1}, {4, 8});
+  ASSERT_TRUE(std::dynamic_pointer_cast<const PosList>(sparse));
+  EXPECT_TRUE(sparse->references_single_chunk());
+
+  auto even_offsets = std::vector<ChunkOffset>(1000);
+  std::iota(even_offsets.begin(), even_offsets.end(), 0);
+  for (auto& chunk_offset : even_offsets) chunk_offset *= 2;
+  const auto dense = make_single_chunk_pos_list(ChunkID{1}, even_offsets);
+  ASSERT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(dense));
+  EXPECT_EQ(dense->get(999), (RowID{ChunkID{1}, 1998}));
+}
+
+TEST_F(StoragePosListTest, ReferenceSegmentOnCompressedPosList) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  for (auto row = 0; row < 300; ++row) table->append({row});
+  table->compress_chunk(ChunkID{1});
+
+  const auto range_segment = ReferenceSegment{table, ColumnID{0}, std::make_shared<RangePosList>(ChunkID{1}, 10, 13)};
+  EXPECT_EQ(range_segment.materialize<int>(), (std::vector<int>{110, 111, 112}));
+  EXPECT_EQ(range_segment[1], AllTypeVariant{111});
+
+  const auto bitmap_pos_list = std::make_shared<BitmapPosList>(ChunkID{2}, std::vector<ChunkOffset>{0, 99});
+  const auto bitmap_segment = ReferenceSegment{table, ColumnID{0}, bitmap_pos_list};
+  EXPECT_EQ(bitmap_segment.materialize<int>(), (std::vector<int>{200, 299}));
+  EXPECT_EQ(bitmap_segment.estimate_memory_usage(), bitmap_segment.pos_list()->memory_usage());
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentString) {
+  for (const auto& value : {"Bill", "Bill", "Steve", "Bill", "Bill", "Bill", "Hasso"}) vc_str->append(value);
+
+  auto col = make_shared_by_data_type<BaseSegment, RunLengthSegment>("string", vc_str);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthSegment<std::string>>(col);
+
+  EXPECT_EQ(rle_col->size(), 7u);
+  EXPECT_EQ(rle_col->run_count(), 4u);
+  EXPECT_EQ(*rle_col->values(), (std::vector<std::string>{"Bill", "Steve", "Bill", "Hasso"}));
+  EXPECT_EQ(*rle_col->end_positions(), (std::vector<ChunkOffset>{1, 2, 5, 6}));
+}
+
+TEST_F(StorageRunLengthSegmentTest, PointAccess) {
+  for (int i = 0; i < 100; ++i) vc_int->append(i / 10);
+
+  auto rle_col = std::make_shared<RunLengthSegment<int>>(vc_int);
+
+  EXPECT_EQ(rle_col->run_count(), 10u);
+  for (ChunkOffset chunk_offset = 0; chunk_offset < 100; ++chunk_offset) {
+    EXPECT_EQ(rle_col->get(chunk_offset), static_cast<int>(chunk_offset / 10));
+  }
+  EXPECT_EQ((*rle_col)[55], AllTypeVariant{5});
+}
+
+TEST_F(StorageRunLengthSegmentTest, ForEachRun) {
+  for (const auto value : {3, 3, 3, 1, 4, 4}) vc_int->append(value);
+  auto rle_col = std::make_shared<RunLengthSegment<int>>(vc_int);
+
+  std::vector<std::tuple<int, ChunkOffset, ChunkOffset>> runs;
+  rle_col->for_each_run([&](const int value, const ChunkOffset begin, const ChunkOffset end) {
+    runs.emplace_back(value, begin, end);
+  });
+
+  EXPECT_EQ(runs, (std::vector<std::tuple<int, ChunkOffset, ChunkOffset>>{{3, 0, 3}, {1, 3, 4}, {4, 4, 6}}));
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  auto rle_col = std::make_shared<RunLengthSegment<int>>(vc_int);
+  EXPECT_EQ(rle_col->size(), 0u);
+  EXPECT_EQ(rle_col->run_count(), 0u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, IsImmutable) {
+  vc_int->append(1);
+  auto rle_col = std::make_shared<RunLengthSegment<int>>(vc_int);
+  EXPECT_THROW(rle_col->append(2), std::exception);
+}
+
+TEST_F(StorageRunLengthSegmentTest, MemoryUsage) {
+  for (int i = 0; i < 100; ++i) vc_int->append(i / 50);
+  auto rle_col = std::make_shared<RunLengthSegment<int>>(vc_int);
+
+  // two runs with a 4-byte value and a 4-byte end position each
+  EXPECT_EQ(rle_col->estimate_memory_usage(), 16u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,83 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/reference_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto row = 0; row < 5000; ++row) {
+      const auto value = row / 3 % 100;
+      int_values.push_back(value);
+      string_values.push_back("value " + std::to_string(value));
+      vc_int->append(value);
+      vc_str->append(string_values.back());
+    }
+  }
+
+  template <typename T>
+  static std::vector<T> iterate(const BaseSegment& segment) {
+    auto values = std::vector<T>{};
+    segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+      EXPECT_EQ(chunk_offset, values.size());
+      values.push_back(value);
+    });
+    return values;
+  }
+
+  std::vector<int> int_values;
+  std::vector<std::string> string_values;
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageSegmentIterateTest, IterateEncodedSegments) {
+  for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
+                                   EncodingType::FrameOfReference}) {
+    EXPECT_EQ(iterate<int>(*encode_segment(encoding_type, "int", vc_int)), int_values);
+  }
+  for (const auto encoding_type :
+       {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FSST}) {
+    EXPECT_EQ(iterate<std::string>(*encode_segment(encoding_type, "string", vc_str)), string_values);
+  }
+}
+
+TEST_F(StorageSegmentIterateTest, IterateReferenceSegment) {
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  for (const auto value : int_values) table->append({value});
+  table->compress_chunk(ChunkID{1});
+
+  // positions jump between an uncompressed and a compressed chunk
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->push_back(RowID{ChunkID{1}, 5});
+  pos_list->push_back(RowID{ChunkID{1}, 1});
+  pos_list->push_back(RowID{ChunkID{0}, 999});
+  pos_list->push_back(RowID{ChunkID{4}, 0});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+
+  EXPECT_EQ(iterate<int>(reference_segment),
+            (std::vector<int>{int_values[1005], int_values[1001], int_values[999], int_values[4000]}));
+}
+
+TEST_F(StorageSegmentIterateTest, ResolveSegmentType) {
+  const auto dictionary_segment = encode_segment(EncodingType::Dictionary, "int", vc_int);
+  auto resolved = false;
+  resolve_segment_type<int>(*dictionary_segment, [&](const auto& segment) {
+    resolved = std::is_same_v<std::decay_t<decltype(segment)>, DictionarySegment<int>>;
+  });
+  EXPECT_TRUE(resolved);
+}
+
+}  // namespace opossum
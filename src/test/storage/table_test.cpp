@@ -1,6 +1,9 @@
 #include <limits>
 #include <memory>
+#include <numeric>
+#include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,7 +11,9 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -40,6 +45,80 @@ TEST_F(StorageTableTest, GetChunk) {
   t.get_chunk(ChunkID{1});
 }
 
+TEST_F(StorageTableTest, EmplaceChunk) {
+  const auto make_chunk = [](std::vector<int> ids, std::vector<std::string> names) {
+    auto chunk = Chunk{};
+    chunk.add_segment(std::make_shared<ValueSegment<int>>(std::move(ids)));
+    chunk.add_segment(std::make_shared<ValueSegment<std::string>>(std::move(names)));
+    return chunk;
+  };
+
+  // the empty first chunk is replaced, the segments are moved in
+  auto chunk = make_chunk({1, 2, 3}, {"a", "b", "c"});
+  const auto segment = chunk.get_segment(ColumnID{0});
+  t.emplace_chunk(std::move(chunk));
+  EXPECT_EQ(t.chunk_count(), 1u);
+  EXPECT_EQ(t.row_count(), 3u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}), segment);
+
+  auto chunks = std::vector<Chunk>{};
+  chunks.push_back(make_chunk({4}, {"d"}));
+  chunks.push_back(make_chunk({5, 6}, {"e", "f"}));
+  t.emplace_chunks(std::move(chunks));
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_EQ(t.row_count(), 6u);
+
+  // emplaced chunks are not appended to
+  t.append({7, "g"});
+  EXPECT_EQ(t.chunk_count(), 4u);
+  EXPECT_EQ(t.get_chunk(ChunkID{3}).size(), 1u);
+}
+
+TEST_F(StorageTableTest, EmplaceChunkIntoUnboundedTable) {
+  // chunks of a default-constructed table are not pre-sized, appends to them would grow the moved-in segments
+  auto table = Table{};
+  table.add_column("a", "int");
+  auto chunk = Chunk{};
+  const auto segment = std::make_shared<ValueSegment<int>>(std::vector<int>{1, 2});
+  chunk.add_segment(segment);
+  table.emplace_chunk(std::move(chunk));
+
+  table.append({3});
+  EXPECT_EQ(segment->size(), 2u);
+  EXPECT_EQ(table.chunk_count(), 2u);
+  EXPECT_EQ(table.get_chunk(ChunkID{1}).size(), 1u);
+  EXPECT_EQ(table.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, EmplaceChunkRejectsMismatchingChunk) {
+  auto missing_column = Chunk{};
+  missing_column.add_segment(std::make_shared<ValueSegment<int>>(std::vector<int>{1}));
+  EXPECT_THROW(t.emplace_chunk(std::move(missing_column)), std::exception);
+
+  auto wrong_type = Chunk{};
+  wrong_type.add_segment(std::make_shared<ValueSegment<int>>(std::vector<int>{1}));
+  wrong_type.add_segment(std::make_shared<ValueSegment<int>>(std::vector<int>{1}));
+  EXPECT_THROW(t.emplace_chunk(std::move(wrong_type)), std::exception);
+
+  auto different_sizes = Chunk{};
+  different_sizes.add_segment(std::make_shared<ValueSegment<int>>(std::vector<int>{1}));
+  different_sizes.add_segment(std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"a", "b"}));
+  EXPECT_THROW(t.emplace_chunk(std::move(different_sizes)), std::exception);
+
+  EXPECT_EQ(t.chunk_count(), 1u);
+  EXPECT_EQ(t.row_count(), 0u);
+}
+
+TEST_F(StorageTableTest, CreateNewChunk) {
+  t.append({1, "a"});
+  t.create_new_chunk();
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).column_count(), 2u);
+
+  t.append({2, "b"});
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).size(), 1u);
+}
+
 TEST_F(StorageTableTest, ColumnCount) { EXPECT_EQ(t.column_count(), 2u); }
 
 TEST_F(StorageTableTest, RowCount) {
@@ -71,4 +150,297 @@ TEST_F(StorageTableTest, GetColumnIdByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.max_chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, CompressChunkWithPinnedEncoding) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+
+  t.set_column_encoding(ColumnID{0}, EncodingType::FrameOfReference);
+  t.set_column_encoding(ColumnID{1}, EncodingType::FSST);
+  EXPECT_EQ(t.column_encoding(ColumnID{0}), EncodingType::FrameOfReference);
+  t.compress_chunk(ChunkID{0});
+
+  const auto segment_encodings = t.segment_encodings();
+  ASSERT_EQ(segment_encodings.size(), 4u);
+  EXPECT_EQ(segment_encodings[0].encoding_type, EncodingType::FrameOfReference);
+  EXPECT_EQ(segment_encodings[1].encoding_type, EncodingType::FSST);
+  EXPECT_EQ(segment_encodings[2].encoding_type, EncodingType::Unencoded);
+  EXPECT_EQ(segment_encodings[3].chunk_id, ChunkID{1});
+  EXPECT_EQ(segment_encodings[3].column_id, ColumnID{1});
+  EXPECT_EQ(segment_encodings[0].memory_usage,
+            t.get_chunk(ChunkID{0}).get_segment(ColumnID{0})->estimate_memory_usage());
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1]), "world");
+
+  t.reset_column_encoding(ColumnID{0});
+  EXPECT_FALSE(t.column_encoding(ColumnID{0}));
+}
+
+TEST_F(StorageTableTest, UnencodedChunksAreCompressedOnce) {
+  t.append({1, "a"});
+  t.append({2, "b"});
+  t.set_column_encoding(ColumnID{0}, EncodingType::Unencoded);
+  t.set_column_encoding(ColumnID{1}, EncodingType::Unencoded);
+
+  t.compress_chunk(ChunkID{0});
+  const auto compressed_chunk = t.get_chunk_ptr(ChunkID{0});
+  EXPECT_TRUE(compressed_chunk->is_compressed());
+  EXPECT_EQ(t.segment_encodings()[0].encoding_type, EncodingType::Unencoded);
+
+  // the chunk keeps the encodings chosen for it, even if other encodings are pinned later
+  t.set_column_encoding(ColumnID{0}, EncodingType::Dictionary);
+  t.compress_chunk(ChunkID{0});
+  EXPECT_EQ(t.get_chunk_ptr(ChunkID{0}), compressed_chunk);
+}
+
+TEST_F(StorageTableTest, CompressAllChunks) {
+  for (auto row = 0; row < 9; ++row) t.append({row, "row " + std::to_string(row % 3)});
+  t.set_column_encoding(ColumnID{1}, EncodingType::Dictionary);
+
+  // readers holding a chunk keep it even if it is replaced
+  const auto old_chunk = t.get_chunk_ptr(ChunkID{0});
+  t.compress_all_chunks();
+  EXPECT_NE(t.get_chunk_ptr(ChunkID{0}), old_chunk);
+  EXPECT_EQ(type_cast<int>((*old_chunk->get_segment(ColumnID{0}))[1]), 1);
+
+  EXPECT_EQ(t.row_count(), 9u);
+  for (const auto& segment_encoding : t.segment_encodings()) {
+    if (segment_encoding.column_id == ColumnID{1}) {
+      EXPECT_EQ(segment_encoding.encoding_type, EncodingType::Dictionary);
+    }
+  }
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{4}).get_segment(ColumnID{1}))[0]), "row 2");
+
+  // the partially filled last chunk has been sealed, so the next row goes to a new chunk
+  EXPECT_EQ(t.chunk_count(), 5u);
+  t.append({9, "row 0"});
+  EXPECT_EQ(t.chunk_count(), 6u);
+  EXPECT_EQ(t.get_chunk(ChunkID{4}).size(), 1u);
+  EXPECT_EQ(t.row_count(), 10u);
+
+  // compressed chunks are not compressed again
+  const auto compressed_chunk = t.get_chunk_ptr(ChunkID{0});
+  t.compress_chunks(ChunkID{0}, ChunkID{2});
+  EXPECT_EQ(t.get_chunk_ptr(ChunkID{0}), compressed_chunk);
+  EXPECT_THROW(t.compress_chunks(ChunkID{3}, ChunkID{7}), std::exception);
+}
+
+TEST_F(StorageTableTest, CompressDuringConcurrentAppend) {
+  constexpr auto THREAD_COUNT = 4;
+  constexpr auto ROWS_PER_THREAD = 2000;
+
+  // pre-sized chunks are appended to without a lock, unbounded ones under the append mutex
+  for (const auto chunk_size : {uint32_t{1000}, std::numeric_limits<uint32_t>::max() - 1}) {
+    auto table = Table{chunk_size};
+    table.add_column("a", "int");
+
+    auto threads = std::vector<std::thread>{};
+    for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+      threads.emplace_back([&]() {
+        for (auto row = 0; row < ROWS_PER_THREAD; ++row) table.append({row});
+      });
+    }
+    for (auto compression = 0; compression < 20; ++compression) {
+      table.compress_chunk(ChunkID{table.chunk_count() - 1});
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(table.row_count(), uint64_t{THREAD_COUNT * ROWS_PER_THREAD});
+  }
+}
+
+TEST_F(StorageTableTest, FailedAppendKeepsChunkUsable) {
+  // a value that cannot be converted must not leave a reserved row behind that later appends and seal() wait for
+  EXPECT_THROW(t.append({"not a number", "a"}), std::exception);
+  t.append({1, "b"});
+  EXPECT_EQ(t.row_count(), 1u);
+
+  t.set_column_encoding(ColumnID{0}, EncodingType::Dictionary);
+  t.compress_chunk(ChunkID{0});
+  const auto segment = t.get_chunk_ptr(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ(get_encoding_type("int", segment), EncodingType::Dictionary);
+  EXPECT_EQ(segment->size(), 1u);
+  EXPECT_EQ((*segment)[0], AllTypeVariant{1});
+}
+
+TEST_F(StorageTableTest, AutoCompression) {
+  t.set_column_encoding(ColumnID{0}, EncodingType::RunLength);
+  t.set_column_encoding(ColumnID{1}, EncodingType::Dictionary);
+  EXPECT_FALSE(t.auto_compression());
+  t.set_auto_compression(true);
+
+  for (auto row = 0; row < 7; ++row) t.append({row, "row " + std::to_string(row)});
+  t.wait_for_compression();
+
+  // only full chunks are compressed, the last chunk is still open for appends
+  for (const auto& segment_encoding : t.segment_encodings()) {
+    if (segment_encoding.chunk_id == ChunkID{3}) {
+      EXPECT_EQ(segment_encoding.encoding_type, EncodingType::Unencoded);
+    } else if (segment_encoding.column_id == ColumnID{0}) {
+      EXPECT_EQ(segment_encoding.encoding_type, EncodingType::RunLength);
+    } else {
+      EXPECT_EQ(segment_encoding.encoding_type, EncodingType::Dictionary);
+    }
+  }
+  EXPECT_EQ(t.row_count(), 7u);
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk_ptr(ChunkID{2})->get_segment(ColumnID{1}))[1]), "row 5");
+
+  t.append({7, "row 7"});
+  t.wait_for_compression();
+  EXPECT_EQ(get_encoding_type("int", t.get_chunk_ptr(ChunkID{3})->get_segment(ColumnID{0})), EncodingType::RunLength);
+}
+
+TEST_F(StorageTableTest, DestructorWaitsForCompression) {
+  // chunks that are not pre-sized are only sealed once they are compressed
+  const auto chunk_size = Table::MAX_PRESIZED_CHUNK_SIZE + 1;
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", "int");
+  table->set_auto_compression(true);
+  auto values = std::vector<int>(chunk_size);
+  std::iota(values.begin(), values.end(), 0);
+  table->append_segments({std::make_shared<ValueSegment<int>>(std::move(values))});
+  const auto chunk = table->get_chunk_ptr(ChunkID{0});
+
+  // compressions still pending reference the table, so destroying it has to wait for them
+  table.reset();
+  EXPECT_TRUE(chunk->is_sealed());
+}
+
+TEST_F(StorageTableTest, MoveWaitsForCompression) {
+  auto table = Table{100};
+  table.add_column("a", "int");
+  table.set_auto_compression(true);
+  for (auto row = 0; row < 1000; ++row) table.append({row});
+
+  // the compressions scheduled on the moved-from table have finished before its chunks are taken over
+  auto moved_table = std::move(table);
+  EXPECT_TRUE(moved_table.auto_compression());
+  EXPECT_EQ(moved_table.row_count(), 1000u);
+  for (const auto& segment_encoding : moved_table.segment_encodings()) {
+    EXPECT_NE(segment_encoding.encoding_type, EncodingType::Unencoded);
+  }
+}
+
+TEST_F(StorageTableTest, SetColumnEncodingRejectsUnsupportedType) {
+  EXPECT_THROW(t.set_column_encoding(ColumnID{0}, EncodingType::FSST), std::exception);
+  EXPECT_THROW(t.set_column_encoding(ColumnID{1}, EncodingType::FrameOfReference), std::exception);
+}
+
+TEST_F(StorageTableTest, AppendSegments) {
+  t.append({1, "one"});
+  auto names = std::vector<std::string>{"two", "three", "four", "five"};
+  t.append_segments({std::make_shared<ValueSegment<int>>(std::vector<int>{2, 3, 4, 5}),
+                     std::make_shared<ValueSegment<std::string>>(std::move(names))});
+
+  // the rows fill up the open chunk first
+  EXPECT_EQ(t.row_count(), 5u);
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_EQ(type_cast<int>((*t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[1]), 2);
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{2}).get_segment(ColumnID{1}))[0]), "five");
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).segment_filters(ColumnID{0}).size(), 1u);
+
+  t.append({6, "six"});
+  EXPECT_EQ(t.get_chunk(ChunkID{2}).size(), 2u);
+
+  EXPECT_THROW(t.append_segments({std::make_shared<ValueSegment<int>>(std::vector<int>{7})}), std::exception);
+  EXPECT_THROW(t.append_segments({std::make_shared<ValueSegment<int>>(std::vector<int>{7}),
+                                  std::make_shared<ValueSegment<int>>(std::vector<int>{7})}),
+               std::exception);
+  EXPECT_THROW(t.append_segments({std::make_shared<ValueSegment<int>>(std::vector<int>{7, 8}),
+                                  std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"seven"})}),
+               std::exception);
+  EXPECT_EQ(t.row_count(), 6u);
+}
+
+TEST_F(StorageTableTest, AppendSegmentsToUnboundedChunk) {
+  auto table = Table{};
+  table.add_column("a", "int");
+  table.append({1});
+  table.append_segments({std::make_shared<ValueSegment<int>>(std::vector<int>{2, 3})});
+
+  EXPECT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(table.row_count(), 3u);
+  EXPECT_EQ(type_cast<int>((*table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[2]), 3);
+}
+
+TEST_F(StorageTableTest, ConcurrentAppend) {
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto ROWS_PER_THREAD = 1000;
+
+  auto table = Table{100};
+  table.add_column("thread", "int");
+  table.add_column("row", "string");
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto row = 0; row < ROWS_PER_THREAD; ++row) table.append({thread_id, std::to_string(row)});
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(table.row_count(), uint64_t{THREAD_COUNT * ROWS_PER_THREAD});
+  EXPECT_EQ(table.chunk_count(), ChunkID{THREAD_COUNT * ROWS_PER_THREAD / 100});
+
+  // every row has been written exactly once and the values of a row stay together
+  auto rows = std::set<std::pair<int, std::string>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    EXPECT_EQ(chunk.size(), 100u);
+    EXPECT_EQ(chunk.segment_filters(ColumnID{0}).size(), 1u);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      rows.emplace(type_cast<int>((*chunk.get_segment(ColumnID{0}))[chunk_offset]),
+                   type_cast<std::string>((*chunk.get_segment(ColumnID{1}))[chunk_offset]));
+    }
+  }
+  EXPECT_EQ(rows.size(), size_t{THREAD_COUNT * ROWS_PER_THREAD});
+}
+
+TEST_F(StorageTableTest, ConcurrentAppendToUnboundedChunk) {
+  constexpr auto THREAD_COUNT = 4;
+  constexpr auto ROWS_PER_THREAD = 1000;
+
+  auto table = Table{};
+  table.add_column("a", "int");
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto row = 0; row < ROWS_PER_THREAD; ++row) table.append({row});
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(table.row_count(), uint64_t{THREAD_COUNT * ROWS_PER_THREAD});
+}
+
+TEST_F(StorageTableTest, ReadUnboundedChunkDuringAppend) {
+  // the chunks of a default-constructed table are not pre-sized, so their segments grow while they are read
+  auto table = Table{};
+  table.add_column("a", "int");
+  table.add_column("b", "int");
+  constexpr auto ROW_COUNT = 20'000;
+
+  auto writer = std::thread{[&]() {
+    for (auto row = 0; row < ROW_COUNT; ++row) table.append({row, -row});
+  }};
+
+  auto read_rows = size_t{0};
+  while (read_rows < ROW_COUNT) {
+    const auto chunk = table.get_chunk_ptr(ChunkID{0});
+    const auto row_count = chunk->size();
+    const auto a = std::static_pointer_cast<const ValueSegment<int>>(chunk->get_segment(ColumnID{0}))->values();
+    const auto b = std::static_pointer_cast<const ValueSegment<int>>(chunk->get_segment(ColumnID{1}))->values();
+    ASSERT_GE(a.size(), row_count);
+    ASSERT_GE(b.size(), row_count);
+    for (auto row = read_rows; row < row_count; ++row) {
+      ASSERT_EQ(a[row], static_cast<int>(row));
+      ASSERT_EQ(b[row], -static_cast<int>(row));
+    }
+    read_rows = row_count;
+  }
+  writer.join();
+  EXPECT_EQ(table.row_count(), static_cast<uint64_t>(ROW_COUNT));
+}
+
 }  // namespace opossum
@@ -52,6 +52,57 @@ TEST_F(StorageValueSegmentTest, MemoryUsage) {
   EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{4});
   int_value_segment.append(2);
   EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{8});
+  // rows that have been allocated but not appended yet are included
+  int_value_segment.append(3);
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{16});
+  int_value_segment.presize(10);
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{40});
+}
+
+TEST_F(StorageValueSegmentTest, ValuesSurviveGrowth) {
+  int_value_segment.append(1);
+  const auto values = int_value_segment.values();
+  for (auto value = 2; value <= 100; ++value) int_value_segment.append(value);
+
+  ASSERT_EQ(values.size(), 1u);
+  EXPECT_EQ(values[0], 1);
+  EXPECT_EQ(int_value_segment.values().size(), 100u);
+  EXPECT_EQ(int_value_segment.values()[99], 100);
+}
+
+TEST_F(StorageValueSegmentTest, WriteAndCommitPresizedRows) {
+  string_value_segment.presize(3);
+  EXPECT_EQ(string_value_segment.size(), 0u);
+  EXPECT_TRUE(string_value_segment.values().empty());
+
+  string_value_segment.write(1, "b");
+  string_value_segment.write(0, "a");
+  string_value_segment.commit(2);
+  EXPECT_EQ(string_value_segment.size(), 2u);
+  EXPECT_EQ(std::vector<std::string>(string_value_segment.values().begin(), string_value_segment.values().end()),
+            (std::vector<std::string>{"a", "b"}));
+
+  // appending fills the remaining allocated row first
+  string_value_segment.append("c");
+  string_value_segment.append("d");
+  EXPECT_EQ(string_value_segment.size(), 4u);
+  EXPECT_EQ(string_value_segment.values()[3], "d");
+}
+
+TEST_F(StorageValueSegmentTest, AppendValues) {
+  const auto source = ValueSegment<int>{std::vector<int>{1, 2, 3, 4}};
+  EXPECT_EQ(source.size(), 4u);
+
+  int_value_segment.append(0);
+  int_value_segment.presize(3);
+  int_value_segment.append_values(source, 1, 3);
+  EXPECT_EQ(std::vector<int>(int_value_segment.values().begin(), int_value_segment.values().end()),
+            (std::vector<int>{0, 2, 3, 4}));
+
+  int_value_segment.presize(6);
+  int_value_segment.write_values(4, source, 0, 2);
+  int_value_segment.commit(6);
+  EXPECT_EQ(int_value_segment.values()[5], 2);
 }
 
 }  // namespace opossum
@@ -0,0 +1,77 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/zone_map.hpp"
+
+namespace opossum {
+
+class StorageZoneMapTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+};
+
+TEST_F(StorageZoneMapTest, BuildFromValueSegment) {
+  for (const auto value : {17, 4, 42, 23}) vc_int->append(value);
+
+  const auto zone_map = ZoneMap<int>{vc_int};
+  EXPECT_EQ(zone_map.min(), 4);
+  EXPECT_EQ(zone_map.max(), 42);
+}
+
+TEST_F(StorageZoneMapTest, CanPrune) {
+  const auto zone_map = ZoneMap<int>{10, 20};
+
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpEquals, 9));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpEquals, 10));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpEquals, 20));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpEquals, 21));
+
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpNotEquals, 10));
+  EXPECT_TRUE(ZoneMap<int>(7, 7).can_prune(ScanType::OpNotEquals, 7));
+
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpLessThan, 10));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpLessThan, 11));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpLessThanEquals, 9));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpLessThanEquals, 10));
+
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpGreaterThan, 20));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpGreaterThan, 19));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpGreaterThanEquals, 21));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpGreaterThanEquals, 20));
+}
+
+TEST_F(StorageZoneMapTest, CanPruneString) {
+  const auto zone_map = ZoneMap<std::string>{"Bill", "Steve"};
+
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpEquals, "Alexander"));
+  EXPECT_FALSE(zone_map.can_prune(ScanType::OpEquals, "Hasso"));
+  EXPECT_TRUE(zone_map.can_prune(ScanType::OpGreaterThan, "Steve"));
+}
+
+TEST_F(StorageZoneMapTest, TableAddsZoneMapsToFullAndCompressedChunks) {
+  auto table = Table{3};
+  table.add_column("a", "int");
+  for (const auto value : {1, 2, 3, 4, 5, 6, 7}) table.append({value});
+
+  // the last chunk is not full yet and may still change
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).segment_filters(ColumnID{0}).size(), 1u);
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).segment_filters(ColumnID{0}).size(), 0u);
+  EXPECT_TRUE(table.get_chunk(ChunkID{0}).can_prune(ColumnID{0}, ScanType::OpGreaterThan, 3));
+  EXPECT_FALSE(table.get_chunk(ChunkID{1}).can_prune(ColumnID{0}, ScanType::OpGreaterThan, 3));
+
+  table.compress_chunk(ChunkID{1});
+  const auto& filters = table.get_chunk(ChunkID{1}).segment_filters(ColumnID{0});
+  ASSERT_EQ(filters.size(), 1u);
+  const auto zone_map = std::dynamic_pointer_cast<const ZoneMap<int>>(filters.front());
+  ASSERT_TRUE(zone_map);
+  EXPECT_EQ(zone_map->min(), 4);
+  EXPECT_EQ(zone_map->max(), 6);
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/parallel_sort.hpp"
+
+namespace opossum {
+
+class UtilsParallelSortTest : public BaseTest {
+ protected:
+  std::vector<int> random_values(const size_t count) {
+    auto generator = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int>{-1000, 1000};
+    auto values = std::vector<int>(count);
+    for (auto& value : values) value = distribution(generator);
+    return values;
+  }
+};
+
+TEST_F(UtilsParallelSortTest, SortsLikeStdSort) {
+  for (const auto part_count : {1u, 2u, 3u, 4u, 7u}) {
+    auto values = random_values(10'001);
+    auto expected_values = values;
+    std::sort(expected_values.begin(), expected_values.end());
+
+    parallel_sort(values.begin(), values.end(), std::less<int>{}, part_count);
+    EXPECT_EQ(values, expected_values);
+  }
+
+  // by default, the parts match the WorkerPool
+  auto values = random_values(10'001);
+  auto expected_values = values;
+  std::sort(expected_values.begin(), expected_values.end());
+  parallel_sort(values.begin(), values.end(), std::less<int>{});
+  EXPECT_EQ(values, expected_values);
+}
+
+TEST_F(UtilsParallelSortTest, MorePartsThanValues) {
+  auto values = std::vector<int>{3, 1, 2};
+  parallel_sort(values.begin(), values.end(), std::greater<int>{}, 8);
+  EXPECT_EQ(values, (std::vector<int>{3, 2, 1}));
+
+  auto empty_values = std::vector<int>{};
+  parallel_sort(empty_values.begin(), empty_values.end(), std::less<int>{}, 4);
+  EXPECT_TRUE(empty_values.empty());
+}
+
+}  // namespace opossum
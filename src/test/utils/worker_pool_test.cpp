@@ -0,0 +1,76 @@
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/worker_pool.hpp"
+
+namespace opossum {
+
+class UtilsWorkerPoolTest : public BaseTest {};
+
+TEST_F(UtilsWorkerPoolTest, ExecuteAndWait) {
+  auto worker_pool = WorkerPool{4};
+  EXPECT_EQ(worker_pool.worker_count(), 4u);
+
+  auto results = std::vector<int>(1000);
+  auto tasks = std::vector<std::function<void()>>{};
+  for (auto index = 0; index < 1000; ++index) tasks.emplace_back([&, index]() { results[index] = index * 2; });
+  worker_pool.execute_and_wait(std::move(tasks));
+
+  for (auto index = 0; index < 1000; ++index) EXPECT_EQ(results[index], index * 2);
+}
+
+TEST_F(UtilsWorkerPoolTest, NestedTasksDoNotDeadlock) {
+  // more outer tasks than workers, each of which waits for inner tasks
+  auto worker_pool = WorkerPool{2};
+  auto counter = std::atomic<int>{0};
+
+  auto tasks = std::vector<std::function<void()>>{};
+  for (auto outer = 0; outer < 8; ++outer) {
+    tasks.emplace_back([&]() {
+      auto inner_tasks = std::vector<std::function<void()>>{};
+      for (auto inner = 0; inner < 8; ++inner) inner_tasks.emplace_back([&]() { ++counter; });
+      worker_pool.execute_and_wait(std::move(inner_tasks));
+    });
+  }
+  worker_pool.execute_and_wait(std::move(tasks));
+
+  EXPECT_EQ(counter, 64);
+}
+
+TEST_F(UtilsWorkerPoolTest, WaitFromTask) {
+  // the only worker waits for a task that is queued behind it, so it has to run that task itself
+  auto worker_pool = WorkerPool{1};
+  auto inner_finished = false;
+  auto outer = worker_pool.schedule([&]() {
+    const auto inner = worker_pool.schedule([&]() { inner_finished = true; });
+    worker_pool.wait(inner);
+  });
+  // blocking here leaves the inner task to the worker
+  outer.get();
+
+  EXPECT_TRUE(inner_finished);
+}
+
+TEST_F(UtilsWorkerPoolTest, ForwardsExceptions) {
+  auto worker_pool = WorkerPool{2};
+  auto finished = std::atomic<int>{0};
+
+  auto tasks = std::vector<std::function<void()>>{};
+  tasks.emplace_back([]() { throw std::logic_error("task failed"); });
+  for (auto index = 0; index < 10; ++index) tasks.emplace_back([&]() { ++finished; });
+  EXPECT_THROW(worker_pool.execute_and_wait(std::move(tasks)), std::logic_error);
+
+  // all other tasks still ran before the exception was rethrown
+  EXPECT_EQ(finished, 10);
+  EXPECT_THROW(worker_pool.schedule([]() { throw std::logic_error("task failed"); }).get(), std::logic_error);
+}
+
+TEST_F(UtilsWorkerPoolTest, GlobalPool) { EXPECT_GE(WorkerPool::get().worker_count(), 1u); }
+
+}  // namespace opossum